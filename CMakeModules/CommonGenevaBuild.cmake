@@ -63,6 +63,10 @@ IF( NOT DEFINED GENEVA_STATIC )
 	SET( GENEVA_STATIC FALSE )
 ENDIF()
 
+IF( NOT DEFINED GENEVA_WITH_LTO )
+	SET( GENEVA_WITH_LTO FALSE )
+ENDIF()
+
 IF( NOT DEFINED CMAKE_VERBOSE_MAKEFILE )
 	SET( CMAKE_VERBOSE_MAKEFILE FALSE )
 ENDIF()
@@ -124,6 +128,21 @@ SET_LINKER_FLAGS (
 	${GENEVA_STATIC}
 )
 
+################################################################################
+# Optionally enable link-time optimization. This allows the compiler to
+# devirtualize and inline across translation units, which benefits the
+# dispatch-heavy per-iteration code of the optimization algorithms. Off by
+# default, as it noticeably increases link times.
+
+IF( GENEVA_WITH_LTO )
+	IF( ${CMAKE_VERSION} VERSION_LESS "3.9" )
+		MESSAGE ("GENEVA_WITH_LTO requires at least CMake 3.9"
+			 " and will be ignored with this CMake version")
+	ELSE()
+		SET( CMAKE_INTERPROCEDURAL_OPTIMIZATION TRUE )
+	ENDIF()
+ENDIF()
+
 ################################################################################
 # Set other necessary build flags
 
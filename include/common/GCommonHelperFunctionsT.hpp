@@ -1193,6 +1193,11 @@ bool operator==(
 	const gemfony_common_type& x
 	, const gemfony_common_type& y
 ) {
+	// Identical objects compare equal -- skip the token machinery
+	if(&x == &y) {
+		return true;
+	}
+
 	try {
 		x.compare(
 			y
@@ -1217,6 +1222,11 @@ bool operator!=(
 	const gemfony_common_type& x
 	, const gemfony_common_type& y
 ) {
+	// Identical objects can never differ -- skip the token machinery
+	if(&x == &y) {
+		return false;
+	}
+
 	try {
 		x.compare(
 			y
@@ -501,6 +501,39 @@ public:
         return Gem::Common::convertSmartPointer<g_class_type, clone_type>(std::shared_ptr<g_class_type>(this->clone_()));
     }
 
+    /***************************************************************************/
+    /**
+     * Creates a clone of this object with sole ownership, converted to a derived
+     * class and emitted as a std::unique_ptr<>. In contrast to the clone()
+     * overloads this avoids the shared_ptr control block and its atomic
+     * reference counting, which makes it the better fit for strictly local
+     * objects such as the work objects of the unit tests. Note that this
+     * template will only be accessible to the compiler if g_class_type is a
+     * base type of clone_type.
+     *
+     * @return A converted clone of this object, wrapped into a std::unique_ptr
+     */
+    template<typename clone_type>
+    std::unique_ptr<clone_type> clone_unique(
+        typename std::enable_if<std::is_base_of<g_class_type, clone_type>::value>::type *dummy = nullptr
+    ) const {
+        std::unique_ptr<g_class_type> p_base(this->clone_());
+#ifdef DEBUG
+        clone_type *p_derived = dynamic_cast<clone_type *>(p_base.get());
+        if(not p_derived) {
+            throw gemfony_exception(
+                g_error_streamer(DO_LOG, time_and_place)
+                    << "In GCommonInterfaceT<T>::clone_unique<clone_type>() :" << std::endl
+                    << "Error: Invalid conversion to type " << typeid(clone_type).name() << std::endl
+            );
+        }
+#else
+        clone_type *p_derived = static_cast<clone_type *>(p_base.get());
+#endif /* DEBUG */
+        p_base.release();
+        return std::unique_ptr<clone_type>(p_derived);
+    }
+
     /***************************************************************************/
     /**
      * Loads the data of another g_class_type(-derivative), wrapped in a shared pointer. Note that this
@@ -346,7 +346,7 @@ void compare(
     , typename std::enable_if<not Gem::Common::has_gemfony_common_interface<basic_type>::value>::type * = nullptr // Note the negation
 ) {
     bool expectationMet = false;
-    std::string expectation_str;
+    char const *expectation_str = "";
 
     switch (e) {
         case Gem::Common::expectation::FP_SIMILARITY:
@@ -402,7 +402,7 @@ void compare(
     , double = 0.
 ) {
     bool expectationMet = false;
-    std::string expectation_str;
+    char const *expectation_str = "";
 
     switch (e) {
         case Gem::Common::expectation::FP_SIMILARITY:
@@ -458,7 +458,7 @@ void compare(
     , double = 0.
 ) {
     bool expectationMet = false;
-    std::string expectation_str;
+    char const *expectation_str = "";
 
     switch (e) {
         case Gem::Common::expectation::FP_SIMILARITY:
@@ -512,7 +512,7 @@ void compare(
     , typename std::enable_if<std::is_floating_point<fp_type>::value>::type * = nullptr
 ) {
     bool expectationMet = false;
-    std::string expectation_str;
+    char const *expectation_str = "";
 
     switch (e) {
         case Gem::Common::expectation::FP_SIMILARITY: expectation_str = "FP_SIMILARITY";
@@ -572,7 +572,7 @@ void compare(
     , typename std::enable_if<not std::is_floating_point<base_type>::value>::type * = nullptr
 ) {
     bool expectationMet = false;
-    std::string expectation_str;
+    char const *expectation_str = "";
 
     switch (e) {
         case Gem::Common::expectation::FP_SIMILARITY:
@@ -652,7 +652,7 @@ void compare(
     , typename std::enable_if<not std::is_floating_point<base_type>::value>::type * = nullptr
 ) {
     bool expectationMet = false;
-    std::string expectation_str;
+    char const *expectation_str = "";
 
     switch (e) {
         case Gem::Common::expectation::FP_SIMILARITY:
@@ -728,7 +728,7 @@ void compare(
     , typename std::enable_if<std::is_floating_point<fp_type>::value>::type * = nullptr
 ) {
     bool expectationMet = false;
-    std::string expectation_str;
+    char const *expectation_str = "";
     std::size_t deviation_pos = 0;
     std::ostringstream error;
 
@@ -771,19 +771,24 @@ void compare(
                     }
                 }
             } else { // May only be FP_SIMILARITY or EQUALITY in this case
-                for (x_it = x.begin(), y_it = y.begin(); x_it != x.end(); ++x_it, ++y_it) {
-                    if (*x_it != *y_it) {
-                        foundDeviation = true;
-                        deviation_pos = boost::numeric_cast<std::size_t>(
-                            std::distance(
-                                x.begin()
-                                , x_it
-                            ));
-                        error
-                            << "Found deviation between containers:" << std::endl
-                            << x_name << "[" << deviation_pos << "] = " << *x_it << "; " << std::endl
-                            << y_name << "[" << deviation_pos << "] = " << *y_it << "; " << std::endl;
-                        break; // break the loop
+                // Check for equality with a single, flat container comparison first. This is
+                // the common case and lets the library compare the stored values en bloc.
+                // Only when a difference exists do we iterate again in order to locate it.
+                if (x != y) {
+                    for (x_it = x.begin(), y_it = y.begin(); x_it != x.end(); ++x_it, ++y_it) {
+                        if (*x_it != *y_it) {
+                            foundDeviation = true;
+                            deviation_pos = boost::numeric_cast<std::size_t>(
+                                std::distance(
+                                    x.begin()
+                                    , x_it
+                                ));
+                            error
+                                << "Found deviation between containers:" << std::endl
+                                << x_name << "[" << deviation_pos << "] = " << *x_it << "; " << std::endl
+                                << y_name << "[" << deviation_pos << "] = " << *y_it << "; " << std::endl;
+                            break; // break the loop
+                        }
                     }
                 }
             }
@@ -834,7 +839,7 @@ void compare(
     , typename std::enable_if<std::is_floating_point<fp_type>::value>::type * = nullptr
 ) {
     bool expectationMet = false;
-    std::string expectation_str;
+    char const *expectation_str = "";
     std::size_t deviation_pos = 0;
     std::ostringstream error;
 
@@ -877,19 +882,24 @@ void compare(
                     }
                 }
             } else { // May only be FP_SIMILARITY or EQUALITY in this case
-                for (x_it = x.begin(), y_it = y.begin(); x_it != x.end(); ++x_it, ++y_it) {
-                    if (*x_it != *y_it) {
-                        foundDeviation = true;
-                        deviation_pos = boost::numeric_cast<std::size_t>(
-                            std::distance(
-                                x.begin()
-                                , x_it
-                            ));
-                        error
-                            << "Found deviation between containers:" << std::endl
-                            << x_name << "[" << deviation_pos << "] = " << *x_it << "; " << std::endl
-                            << y_name << "[" << deviation_pos << "] = " << *y_it << "; " << std::endl;
-                        break; // break the loop
+                // Check for equality with a single, flat container comparison first. This is
+                // the common case and lets the library compare the stored values en bloc.
+                // Only when a difference exists do we iterate again in order to locate it.
+                if (x != y) {
+                    for (x_it = x.begin(), y_it = y.begin(); x_it != x.end(); ++x_it, ++y_it) {
+                        if (*x_it != *y_it) {
+                            foundDeviation = true;
+                            deviation_pos = boost::numeric_cast<std::size_t>(
+                                std::distance(
+                                    x.begin()
+                                    , x_it
+                                ));
+                            error
+                                << "Found deviation between containers:" << std::endl
+                                << x_name << "[" << deviation_pos << "] = " << *x_it << "; " << std::endl
+                                << y_name << "[" << deviation_pos << "] = " << *y_it << "; " << std::endl;
+                            break; // break the loop
+                        }
                     }
                 }
             }
@@ -941,7 +951,7 @@ void compare(
     , typename std::enable_if<Gem::Common::has_gemfony_common_interface<geneva_type>::value>::type * = nullptr
 ) {
     bool expectationMet = false;
-    std::string expectation_str;
+    char const *expectation_str = "";
     std::ostringstream error;
 
     switch (e) {
@@ -1026,7 +1036,7 @@ void compare(
     , typename std::enable_if<Gem::Common::has_gemfony_common_interface<geneva_type>::value>::type * = nullptr
 ) {
     bool expectationMet = false;
-    std::string expectation_str;
+    char const *expectation_str = "";
     std::ostringstream error;
 
     switch (e) {
@@ -1139,7 +1149,7 @@ void compare(
     , typename std::enable_if<Gem::Common::has_gemfony_common_interface<geneva_type>::value>::type * = nullptr
 ) {
     bool expectationMet = false;
-    std::string expectation_str;
+    char const *expectation_str = "";
     std::ostringstream error;
 
     switch (e) {
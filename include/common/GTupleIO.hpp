@@ -45,6 +45,7 @@
 
 // Standard headers go here
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -72,48 +73,38 @@ struct tuple_output_seq
 
 /******************************************************************************/
 /**
- * Recursively breaks down output of a tuple. Note: this function assumes that
- * the corresponding tuple element may indeed be streamed!
- */
-template <class tuple_type, size_t p>
-std::string g_to_string(
-	const tuple_type& t
-	, const std::string& s
-	, tuple_output_seq<p> sq// This will determine the current value of p
-){
-	std::ostringstream oss;
-	oss << ", " << std::get<std::tuple_size<tuple_type>::value-p>(t);
-	return (g_to_string(t, oss.str(), tuple_output_seq<p-1>()) + s);
-}
-
-/******************************************************************************/
-/**
- * Specialization for the case of a single element in the tuple. This overload
- * makes sure that no attempt is made to continue recursion.
+ * This overload terminates the recursion, as a tuple<>() has no data. It is
+ * meant to cover cases like "std::cout << std::make_tuple();".
  */
 template <class tuple_type>
-std::string g_to_string(
-	const tuple_type& t
-	, const std::string& s
-	, tuple_output_seq<1> sq
-){
-	std::ostringstream oss;
-	oss << std::get<0>(t);
-  	return oss.str() + s;
+void g_to_stream(
+	std::ostream& o
+	, const tuple_type& t
+	, tuple_output_seq<0> sq
+) {
+	/* nothing */
 }
 
 /******************************************************************************/
 /**
- * This command is supposed to add nothing to the string, as a tuple<>()
- * has no data. It is meant to cover cases like "std::cout << std::make_tuple();".
+ * Recursively breaks down output of a tuple, streaming each element into a
+ * caller-provided stream. Writing all elements into a single stream avoids
+ * the temporary stringstream and string concatenation per element that the
+ * previous implementation incurred -- relevant because optimization monitors
+ * convert fitness tuples to text every iteration. Note: this function assumes
+ * that the corresponding tuple element may indeed be streamed!
  */
-template <class tuple_type>
-std::string g_to_string(
-	const tuple_type& t
-	, const std::string& s
-	, tuple_output_seq<0> sq
-) {
-	return std::string() + s;
+template <class tuple_type, size_t p>
+void g_to_stream(
+	std::ostream& o
+	, const tuple_type& t
+	, tuple_output_seq<p> sq // This will determine the current value of p
+){
+	o << std::get<std::tuple_size<tuple_type>::value-p>(t);
+	if(p > 1) { // More elements follow -- emit a separator
+		o << ", ";
+	}
+	g_to_stream(o, t, tuple_output_seq<p-1>());
 }
 
 /******************************************************************************/
@@ -128,8 +119,11 @@ std::string g_to_string(
 	const std::tuple<args...>& t
 ){
 	static const unsigned short int sz = sizeof...(args); // The actual tuple size
-	std::string empty;
-	return std::string("(") + g_to_string(t, empty, tuple_output_seq<sz>()) + std::string(")");
+	std::ostringstream oss;
+	oss << "(";
+	g_to_stream(oss, t, tuple_output_seq<sz>());
+	oss << ")";
+	return oss.str();
 }
 
 /******************************************************************************/
@@ -144,8 +138,11 @@ std::string g_to_string(
 	const boost::tuple<args...>& t
 ){
 	static const unsigned short int sz = sizeof...(args); // The actual tuple size
-	std::string empty;
-	return std::string("(") + g_to_string(t, empty, tuple_output_seq<sz>()) + std::string(")");
+	std::ostringstream oss;
+	oss << "(";
+	g_to_stream(oss, t, tuple_output_seq<sz>());
+	oss << ")";
+	return oss.str();
 }
 /******************************************************************************/
 /**
@@ -61,6 +61,8 @@
 #include <boost/serialization/nvp.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/stream.hpp>
 
 // Geneva headers go here
 #include "courtier/GCourtierEnums.hpp"
@@ -227,38 +229,47 @@ std::string container_to_string(
 	const GCommandContainerT<processable_type, command_type>& container
 	, Gem::Common::serializationMode serMode
 ) {
+	// A thread-local scratch buffer into which the archives serialize their data.
+	// Work items are serialized once per broker transfer, so reusing the buffer's
+	// capacity across calls avoids one large allocation plus an intermediate copy
+	// per outgoing item, compared to a freshly constructed std::ostringstream.
+	thread_local std::string buffer;
+	buffer.clear();
+
 	try {
+		boost::iostreams::stream<boost::iostreams::back_insert_device<std::string>> os(buffer);
+
 		switch (serMode) {
 			case Gem::Common::serializationMode::TEXT: {
-				std::ostringstream oss;
-				boost::archive::text_oarchive oa(oss);
+				boost::archive::text_oarchive oa(os);
 				oa << boost::serialization::make_nvp(
 					"command_container"
 					, container
 				);
-				return oss.str();
-			} break; // archive and stream closed at end of scope
+			} break; // archive closed at end of scope
 
 			case Gem::Common::serializationMode::XML: {
-				std::ostringstream oss;
-				boost::archive::xml_oarchive oa(oss);
+				boost::archive::xml_oarchive oa(os);
 				oa << boost::serialization::make_nvp(
 					"command_container"
 					, container
 				);
-				return oss.str();
 			} break;
 
 			case Gem::Common::serializationMode::BINARY: {
-				std::ostringstream oss(std::ios_base::binary);
-				boost::archive::binary_oarchive oa(oss);
+				// The binary representation is only exchanged between consumer and
+				// client, both of which use this function pair. We may hence omit the
+				// archive header, saving its emission and parsing for every message.
+				boost::archive::binary_oarchive oa(os, boost::archive::no_header);
 				oa << boost::serialization::make_nvp(
 					"command_container"
 					, container
 				);
-				return oss.str();
 			} break;
 		}
+
+		os.flush();
+		return buffer;
 	} catch (const boost::system::system_error &e) {
 		throw gemfony_exception(
 			g_error_streamer(DO_LOG,  time_and_place)
@@ -330,7 +341,8 @@ void container_from_string(
 
 			case Gem::Common::serializationMode::BINARY: {
 				std::istringstream iss(descr, std::ios_base::binary);
-				boost::archive::binary_iarchive ia(iss);
+				// Note: headerless, in line with container_to_string()
+				boost::archive::binary_iarchive ia(iss, boost::archive::no_header);
 				ia >> boost::serialization::make_nvp("command_container", container);
 			} break;
 		}
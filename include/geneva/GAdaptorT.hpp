@@ -637,9 +637,13 @@ public:
 		 }
 
 		 if (adaptionMode::WITHPROBABILITY == m_adaptionMode) { // The most likely case
+			 // m_adProb does not change inside the loop -- adaptAdaption() only acts
+			 // on the adaption parameters of derived classes -- so the fabs-call and
+			 // the construction of the distribution parameter may be hoisted out of it
+			 const std::bernoulli_distribution::param_type adProbParam(gfabs(m_adProb));
 			 for (auto &val: valVec) {
 				 // A likelihood of m_adProb for adaption
-				 if (m_weighted_bool(gr, std::bernoulli_distribution::param_type(gfabs(m_adProb)))) {
+				 if (m_weighted_bool(gr, adProbParam)) {
 					 adaptAdaption(range, gr);
 					 customAdaptions(
 						 val
@@ -57,7 +57,7 @@ namespace Geneva {
  * and indeed for most applications this is not the recommended solution -
  * use the GBooleanCollection instead.
  */
-class GBooleanObject
+class GBooleanObject final
     : public GParameterT<bool>
 {
     ///////////////////////////////////////////////////////////////////////
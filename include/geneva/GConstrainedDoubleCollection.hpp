@@ -60,7 +60,7 @@ namespace Geneva {
  * functions. Using the subscript operator or at() function, or the
  * native iterator, will give you the "raw" data only.
  */
-class GConstrainedDoubleCollection
+class GConstrainedDoubleCollection final
 	: public GConstrainedFPNumCollectionT<double>
 {
 	 ///////////////////////////////////////////////////////////////////////
@@ -45,6 +45,7 @@
 #include <sstream>
 #include <vector>
 #include <type_traits>
+#include <cmath>
 
 // Boost header files go here
 #include <boost/math/special_functions/next.hpp> // Needed so we can calculate the next representable value smaller than a given upper boundary
@@ -174,40 +175,27 @@ public:
      * @param val The value to which the transformation should be applied
      * @return The transformed value
      */
-    fp_type transfer(const fp_type &val) const override {
+    fp_type transfer(const fp_type &val) const final {
         fp_type lowerBoundary = GConstrainedNumCollectionT<fp_type>::getLowerBoundary();
         fp_type upperBoundary = GConstrainedNumCollectionT<fp_type>::getUpperBoundary();
 
         if (val >= lowerBoundary && val < upperBoundary) {
             return val;
         } else {
-            // Find out which region the value is in (compare figure transferFunction.pdf
-            // that should have been delivered with this software). Note that boost::numeric_cast<>
-            // may throw - exceptions must be caught in surrounding functions.
-            std::int32_t region = 0;
-
-#ifdef DEBUG
-            region = boost::numeric_cast<std::int32_t>(
-                Gem::Common::gfloor(
-                    (fp_type(val) - fp_type(lowerBoundary)) / (fp_type(upperBoundary) - fp_type(lowerBoundary))));
-#else
-            region =	static_cast<std::int32_t>(Gem::Common::gfloor((fp_type(val) - fp_type(lowerBoundary)) / (fp_type(upperBoundary) - fp_type(lowerBoundary))));
-#endif
-
-            // Check whether we are in an odd or an even range and calculate the
-            // external value accordingly
-            fp_type mapping = fp_type(0.);
-            if (region % 2 == 0) { // can it be divided by 2 ? Region 0,2,... or a negative even range
-                mapping = val - fp_type(region) * (upperBoundary - lowerBoundary);
-            } else { // Range 1,3,... or a negative odd range
-                mapping = -val + (fp_type(region - 1) * (upperBoundary - lowerBoundary) + 2 * upperBoundary);
-            }
-
-            return mapping;
+            // Fold the value back into the allowed range (compare figure
+            // transferFunction.pdf that should have been delivered with this
+            // software). The mapping is a triangular wave of period 2*range:
+            // even regions map to val - region*range, odd regions mirror the
+            // value at the upper boundary. Expressing it through fmod and fabs
+            // avoids both the floating-point-to-integer conversion and the
+            // data-dependent parity branch of a region-based formulation --
+            // on randomly initialized populations that branch was essentially
+            // unpredictable.
+            fp_type range = upperBoundary - lowerBoundary;
+            fp_type t = std::fmod(val - lowerBoundary, fp_type(2.) * range);
+            t = (t < fp_type(0.)) ? t + fp_type(2.) * range : t;
+            return lowerBoundary + (range - Gem::Common::gfabs(t - range));
         }
-
-        // Make the compiler happy
-        return fp_type(0.);
     }
 
 protected:
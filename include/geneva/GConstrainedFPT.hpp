@@ -272,7 +272,7 @@ public:
 	  * @param val The value to which the transformation should be applied
 	  * @return The transformed value
 	  */
-	 fp_type transfer(const fp_type& val) const  override {
+	 fp_type transfer(const fp_type& val) const final {
 		 // Check if val has a suitable value
 #ifdef DEBUG
 		 switch(std::fpclassify(val)) {
@@ -322,44 +322,25 @@ public:
 		 if(localVal >= lowerBoundary && localVal < upperBoundary) {
 			 return val; // no cast needed
 		 } else {
-			 // Find out which region the value is in (compare figure transferFunction.pdf
-			 // that should have been delivered with this software). Note that boost::numeric_cast<>
-			 // may throw - exceptions must be caught in surrounding functions.
-			 std::int64_t region = 0;
-
-#ifdef DEBUG
-			 long double fp_region = Gem::Common::gfloor((localVal - (long double)(lowerBoundary)) / ((long double)(upperBoundary) - (long double)(lowerBoundary)));
-
-			 if(Gem::Common::gfabs(fp_region) < boost::numeric_cast<long double>((std::numeric_limits<std::int64_t>::max)())) {
-				 // We need floor here, as an integer cast rounds towards 0, which would be wrong for negative values of val
-				 region = boost::numeric_cast<std::int64_t>(fp_region);
-			 } else {
-				 throw gemfony_exception(
-					 g_error_streamer(DO_LOG, time_and_place)
-						 << "In GConstrainedFPT::transfer(): Error" << std::endl
-						 << "fp_region = " << fp_region << " is too large and cannot be" << std::endl
-						 << "converted to a std::int64_t, which has a maximum value of " << (std::numeric_limits<std::int64_t>::max)() << std::endl
-				 );
-			 }
-#else   /* DEBUG */
-			 region =	static_cast<std::int64_t>(Gem::Common::gfloor((localVal - (long double)(lowerBoundary)) / ((long double)(upperBoundary) - (long double)(lowerBoundary))));
-#endif  /* DEBUG */
-
-			 // Check whether we are in an odd or an even range and calculate the
-			 // external value accordingly
-			 long double mapping = (long double)(0.);
-			 if(region%2 == 0) { // can it be divided by 2 ? Region 0,2,... or a negative even range
-				 mapping = localVal - (long double)(region) * (upperBoundary - lowerBoundary);
-			 } else { // Range 1,3,... or a negative odd range
-				 mapping = -localVal + ((long double)(region-1)*(upperBoundary - lowerBoundary) + 2*upperBoundary);
+			 // The mapping is a triangular wave of period 2*range: ranges
+			 // alternate between ascending and descending direction (compare
+			 // figure transferFunction.pdf that should have been delivered with
+			 // this software). Rather than determining the region index and
+			 // branching on its parity, fold the value into one period with
+			 // fmod and reflect around the period's center -- this is free of
+			 // data-dependent branches and avoids the region's int64 detour.
+			 // It is equivalent to the former region-based formulation, which
+			 // remained unchecked against std::int64_t overflow in release mode.
+			 const long double range = upperBoundary - lowerBoundary;
+			 long double t = std::fmod(localVal - lowerBoundary, (long double)(2.) * range);
+			 if(t < (long double)(0.)) {
+				 t += (long double)(2.) * range;
 			 }
+			 const long double mapping = lowerBoundary + (range - Gem::Common::gfabs(t - range));
 
 			 // fabs(mapping) will always be <= fabs(val), so this cast should never fail (if val was a valid fp value)
 			 return boost::numeric_cast<fp_type>(mapping);
 		 }
-
-		 // Make the compiler happy
-		 return fp_type(0.);
 	 }
 
 	 /* ----------------------------------------------------------------------------------
@@ -56,7 +56,7 @@ namespace Geneva {
  * A collection of GConstrainedInt32Object objects, ready for use in a
  * GParameterSet derivative.
  */
-class GConstrainedInt32ObjectCollection
+class GConstrainedInt32ObjectCollection final
     :
         public GParameterTCollectionT<GConstrainedInt32Object>
 {
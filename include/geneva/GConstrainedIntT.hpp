@@ -40,6 +40,8 @@
 #include "common/GGlobalDefines.hpp"
 
 // Standard headers go here
+#include <algorithm>
+#include <cstdint>
 #include <type_traits>
 
 // Boost headers go here
@@ -49,6 +51,7 @@
 #include "geneva/GConstrainedNumT.hpp"
 #include "common/GExceptions.hpp"
 #include "hap/GRandomT.hpp"
+#include "hap/GRandomDistributionsT.hpp"
 
 namespace Gem {
 namespace Geneva {
@@ -79,6 +82,11 @@ class GConstrainedIntT
         & make_nvp(
             "GConstrainedNumT_T"
             , boost::serialization::base_object<GConstrainedNumT<int_type>>(*this));
+
+        // Invalidate the cached value-range information. When loading, the
+        // boundaries may have changed; the cache will be re-calculated on demand.
+        m_value_range_cache = 0;
+        m_range_shift_cache = -1;
     }
     ///////////////////////////////////////////////////////////////////////
 
@@ -181,57 +189,80 @@ public:
     /***************************************************************************/
     /**
      * The transfer function needed to calculate the externally visible value.
+     * Marked final so calls through a GConstrainedIntT (or derived) pointer or
+     * reference may be devirtualized and inlined into evaluation loops.
      *
      * @param val The value to which the transformation should be applied
      * @return The transformed value
      */
-    int_type transfer(const int_type &val) const override {
+    int_type transfer(const int_type &val) const final {
         // Find out the size of the confined area
         int_type lowerBoundary = GConstrainedNumT<int_type>::getLowerBoundary();
         int_type upperBoundary = GConstrainedNumT<int_type>::getUpperBoundary();
 
+        // Converged populations live almost exclusively inside the allowed
+        // region, so the in-range check is strongly biased towards success
+#if defined(__GNUC__)
+        if (__builtin_expect(val >= lowerBoundary && val <= upperBoundary, true)) {
+#else
         if (val >= lowerBoundary && val <= upperBoundary) {
+#endif
             return val;
-        } else {
-            // The result
-            int_type mapping = int_type(0);
-
-            // Find out the size of the value range. Note that both boundaries
-            // are included, so that we need to add 1 to the difference.
-            int_type value_range = upperBoundary - lowerBoundary + int_type(1);
-
-            if (val < lowerBoundary) {
-                // Find out how many full value ranges val is below the lower boundary.
-                // We use integer division here, so 13/4 would be 3.
-                int_type nBelowLowerBoundary = (lowerBoundary - (val + int_type(1))) / value_range;
-
-                // We are dealing with descending (nBelowLowerBoundary is even) and
-                // ascending ranges (nBelowLowerBoundary is odd), which need to be treated differently
-
-                // Transfer the value into the allowed region
-                mapping = val + (value_range * (nBelowLowerBoundary + int_type(1)));
-                if (nBelowLowerBoundary % 2 == 0) { // nBelowLowerBoundary is even
-                    // Revert the value to a descending sequence
-                    mapping = revert(mapping);
-                }
-            } else { // val > getUpperBoundary()
-                // Find out how many full value ranges val is above the upper boundary.
-                // We use integer division here, so 13/4 would be 3.
-                int_type nAboveUpperBoundary = (val - upperBoundary - int_type(1)) / value_range;
-
-                // We are dealing with descending (nAboveUpperBoundary is even) and
-                // ascending ranges (nAboveUpperBoundary is odd), which need to be treated differently
-
-                // Transfer into the allowed region
-                mapping = val - (value_range * (nAboveUpperBoundary + int_type(1)));
-                if (nAboveUpperBoundary % 2 == 0) { // nAboveUpperBoundary is even
-                    // Revert, as we are dealing with a descending value range
-                    mapping = revert(mapping);
-                }
-            }
-
-            return mapping;
         }
+
+        return mapOutsideOfRegion(
+            val
+            , lowerBoundary
+            , upperBoundary
+        );
+    }
+
+    /***************************************************************************/
+    // Make sure the single-argument setValue overload remains accessible
+    using GConstrainedNumT<int_type>::setValue;
+
+    /***************************************************************************/
+    /**
+     * Sets the boundaries of this object. Overridden here so the cached
+     * value-range information is invalidated whenever the boundaries change.
+     *
+     * @param lowerBoundary The new lower boundary for this object
+     * @param upperBoundary The new upper boundary for this object
+     */
+    void setBoundaries(
+        const int_type &lowerBoundary
+        , const int_type &upperBoundary
+    ) override {
+        GConstrainedNumT<int_type>::setBoundaries(
+            lowerBoundary
+            , upperBoundary
+        );
+        m_value_range_cache = 0;
+        m_range_shift_cache = -1;
+    }
+
+    /***************************************************************************/
+    /**
+     * Allows to set the value of this object together with its boundaries.
+     * Overridden here so the cached value-range information is invalidated
+     * whenever the boundaries change.
+     *
+     * @param val The desired new external value
+     * @param lowerBoundary The new lower boundary for this object
+     * @param upperBoundary The new upper boundary for this object
+     */
+    void setValue(
+        const int_type &val
+        , const int_type &lowerBoundary
+        , const int_type &upperBoundary
+    ) override {
+        GConstrainedNumT<int_type>::setValue(
+            val
+            , lowerBoundary
+            , upperBoundary
+        );
+        m_value_range_cache = 0;
+        m_range_shift_cache = -1;
     }
 
 protected:
@@ -242,17 +273,23 @@ protected:
      * @param cp Another GConstrainedIntT<int_type> object, camouflaged as a GObject
      */
     void load_(const GObject *cp) override {
-        // Check that we are dealing with a GConstrainedIntT<int_type> reference independent of this object and convert the pointer
-        const GConstrainedIntT<int_type>
-            *p_load = Gem::Common::g_convert_and_compare<GObject, GConstrainedIntT<int_type>>(
+#ifdef DEBUG
+        // Check that we are dealing with a GConstrainedIntT<int_type> reference independent of
+        // this object. There is no local data to load, so the converted pointer is not needed;
+        // the parent class performs its own (cheaper) conversion check in any case.
+        Gem::Common::g_convert_and_compare<GObject, GConstrainedIntT<int_type>>(
             cp
             , this
         );
+#endif /* DEBUG */
 
         // Load our parent class'es data ...
         GConstrainedNumT<int_type>::load_(cp);
 
-        // no local data
+        // The boundaries may have changed -- invalidate the cached
+        // value-range information so it is re-calculated on demand
+        m_value_range_cache = 0;
+        m_range_shift_cache = -1;
     }
 
     /***************************************************************************/
@@ -312,12 +349,12 @@ protected:
         const activityMode &
         , Gem::Hap::GRandomBase &gr
     ) override {
-        typename std::uniform_int_distribution<int_type> uniform_int(
-            GConstrainedNumT<int_type>::getLowerBoundary()
-            , GConstrainedNumT<int_type>::getUpperBoundary()
-        );
-
-        this->setValue(uniform_int(gr));
+        this->setValue(
+            Gem::Hap::g_uniform_int(
+                gr
+                , GConstrainedNumT<int_type>::getLowerBoundary()
+                , GConstrainedNumT<int_type>::getUpperBoundary()
+            ));
         return true;
     }
 
@@ -393,14 +430,15 @@ protected:
                                 minLower
                                 , maxLower
                         ));
-                int_type upperBoundary;
-                while ((
-                               upperBoundary = uniform_int(
-                                       gr
-                                       , typename std::uniform_int_distribution<int_type>::param_type(
-                                               minUpper
-                                               , maxUpper
-                                       ))) <= lowerBoundary) {}
+                // Draw the upper boundary directly from the still-valid part of its
+                // range instead of rejection sampling. As maxLower < maxUpper, the
+                // range below can never be empty.
+                int_type upperBoundary = uniform_int(
+                        gr
+                        , typename std::uniform_int_distribution<int_type>::param_type(
+                                std::max<int_type>(minUpper, lowerBoundary + 1)
+                                , maxUpper
+                        ));
 
                 BOOST_CHECK_NO_THROW(p_test->setValue(
                         lowerBoundary
@@ -435,14 +473,15 @@ protected:
                                 minLower
                                 , maxLower
                         ));
-                int_type upperBoundary;
-                while ((
-                               upperBoundary = uniform_int(
-                                       gr
-                                       , typename std::uniform_int_distribution<int_type>::param_type(
-                                               minUpper
-                                               , maxUpper
-                                       ))) <= lowerBoundary) {}
+                // Draw the upper boundary directly from the still-valid part of its
+                // range instead of rejection sampling. As maxLower < maxUpper, the
+                // range below can never be empty.
+                int_type upperBoundary = uniform_int(
+                        gr
+                        , typename std::uniform_int_distribution<int_type>::param_type(
+                                std::max<int_type>(minUpper, lowerBoundary + 1)
+                                , maxUpper
+                        ));
 
                 BOOST_CHECK_NO_THROW(p_test->setValue(
                         lowerBoundary
@@ -495,14 +534,15 @@ protected:
                                 minLower
                                 , maxLower
                         ));
-                int_type upperBoundary;
-                while ((
-                               upperBoundary = uniform_int(
-                                       gr
-                                       , typename std::uniform_int_distribution<int_type>::param_type(
-                                               minUpper
-                                               , maxUpper
-                                       ))) <= lowerBoundary) {}
+                // Draw the upper boundary directly from the still-valid part of its
+                // range instead of rejection sampling. As maxLower < maxUpper, the
+                // range below can never be empty.
+                int_type upperBoundary = uniform_int(
+                        gr
+                        , typename std::uniform_int_distribution<int_type>::param_type(
+                                std::max<int_type>(minUpper, lowerBoundary + 1)
+                                , maxUpper
+                        ));
 
                 BOOST_CHECK_NO_THROW(p_test->setValue(
                         lowerBoundary
@@ -618,7 +658,8 @@ protected:
                         , i
                         , 2 * i
                 ));
-                BOOST_CHECK(p_test->revert(probe) == p_test->getUpperBoundary() - (probe - p_test->getLowerBoundary()));
+                BOOST_CHECK(p_test->revert(probe, p_test->getLowerBoundary(), p_test->getUpperBoundary()) ==
+                        p_test->getUpperBoundary() - (probe - p_test->getLowerBoundary()));
             }
         }
 
@@ -659,19 +700,182 @@ private:
 
     /***************************************************************************/
     /**
-     * Reverts the value to descending order. Note: No check is made whether the value
+     * Reverts the value to descending order. The boundaries are passed in by
+     * the caller, which has usually already loaded them into locals, so they
+     * do not need to be re-read here. Note: No check is made whether the value
      * is indeed in the allowed region.
      *
      * @param value The value to be reverted
+     * @param lowerBoundary The lower boundary of the value range
+     * @param upperBoundary The upper boundary of the value range
      * @return The reverted value
      */
-    int_type revert(const int_type &value) const {
-        int_type position = value - GConstrainedNumT<int_type>::getLowerBoundary();
-        int_type reverted = GConstrainedNumT<int_type>::getUpperBoundary() - position;
+    int_type revert(
+        const int_type &value
+        , const int_type &lowerBoundary
+        , const int_type &upperBoundary
+    ) const {
+        int_type position = value - lowerBoundary;
+        int_type reverted = upperBoundary - position;
         return reverted;
     }
+
+    /***************************************************************************/
+    /**
+     * Maps a value outside of the allowed region back into it, alternating
+     * between ascending and descending range segments. This is the cold half
+     * of transfer() -- keeping it out of line leaves the hot in-range path
+     * small enough to be inlined into evaluation loops.
+     *
+     * @param val The out-of-range value to which the mapping should be applied
+     * @param lowerBoundary The lower boundary of the value range
+     * @param upperBoundary The upper boundary of the value range
+     * @return The transformed value
+     */
+#if defined(__GNUC__)
+    __attribute__((noinline, cold))
+#endif
+    int_type mapOutsideOfRegion(
+        const int_type &val
+        , const int_type &lowerBoundary
+        , const int_type &upperBoundary
+    ) const {
+        // All distance arithmetic below is carried out in the unsigned
+        // counterpart of int_type. The distances are mathematically
+        // non-negative, but may exceed the positive range of int_type
+        // itself (e.g. for a value close to the smallest int_type and a
+        // positive lower boundary), which would be undefined behaviour in
+        // signed arithmetic. Unsigned wrap-around yields the exact values.
+        using uint_type = typename std::make_unsigned<int_type>::type;
+
+        // Find out the size of the value range. Note that both boundaries
+        // are included, so that we need to add 1 to the difference. The size
+        // is cached, together with its base-2 logarithm for power-of-two
+        // ranges, so the integer division below may be replaced by a shift.
+        if (m_value_range_cache == 0) {
+            updateValueRangeCache();
+        }
+        const uint_type value_range = m_value_range_cache;
+
+        // The distance of val from the nearest boundary, not counting the
+        // boundary itself
+        const bool below = (val < lowerBoundary);
+        const uint_type distance = below
+            ? uint_type(lowerBoundary) - uint_type(val) - uint_type(1)
+            : uint_type(val) - uint_type(upperBoundary) - uint_type(1);
+
+        // Adaption steps are small by design, so most out-of-range values
+        // overshoot by less than one range-width (a zero quotient). Handle
+        // this with a single compare, bypassing the division machinery.
+        if (distance < value_range) {
+            return below
+                ? int_type(uint_type(lowerBoundary) + distance)
+                : int_type(uint_type(upperBoundary) - distance);
+        }
+
+        // The number of full value ranges contained in distance and the
+        // position within the current range segment
+        const uint_type n = divideByValueRange(distance);
+        const uint_type r = distance - n * value_range;
+
+        // The mapping zig-zags between the boundaries: each segment runs in
+        // the opposite direction of its predecessor. Below the lower
+        // boundary an even number of traversed ranges means the segment
+        // descends away from the lower boundary; above the upper boundary
+        // the roles are reversed. In both cases the result is either
+        // lowerBoundary + r or upperBoundary - r.
+        if (((n & uint_type(1)) == uint_type(0)) == below) {
+            return int_type(uint_type(lowerBoundary) + r);
+        }
+        return int_type(uint_type(upperBoundary) - r);
+    }
+
+    /***************************************************************************/
+    /**
+     * Divides a non-negative distance by the size of the value range, using
+     * the cached shift or magic reciprocal where available. Must only be
+     * called while the value-range cache is valid.
+     *
+     * @param distance A non-negative distance from one of the boundaries
+     * @return The number of full value ranges contained in distance
+     */
+    typename std::make_unsigned<int_type>::type divideByValueRange(
+        const typename std::make_unsigned<int_type>::type &distance
+    ) const {
+        using uint_type = typename std::make_unsigned<int_type>::type;
+
+        if (m_range_shift_cache >= 0) { // the range is a power of two
+            return distance >> m_range_shift_cache;
+        }
+        if (m_range_magic_shift_cache > 0 // a magic reciprocal is available ...
+            && std::uint64_t(distance) <= std::uint64_t(0x7FFFFFFFu)) { // ... and is exact for this dividend
+            return uint_type((std::uint64_t(distance) * m_range_magic_cache) >> m_range_magic_shift_cache);
+        }
+        return distance / m_value_range_cache;
+    }
+
+    /***************************************************************************/
+    /**
+     * Re-calculates the cached size of the value range from the current
+     * boundaries. For ranges that are a power of two the corresponding shift
+     * amount is stored as well, so that transfer() may replace its integer
+     * divisions by shifts. A cached range of 0 marks the cache as invalid --
+     * the true range always comprises at least one value.
+     */
+    void updateValueRangeCache() const {
+        using uint_type = typename std::make_unsigned<int_type>::type;
+
+        m_value_range_cache =
+            uint_type(GConstrainedNumT<int_type>::getUpperBoundary()) -
+            uint_type(GConstrainedNumT<int_type>::getLowerBoundary()) +
+            uint_type(1);
+
+        if ((m_value_range_cache & (m_value_range_cache - uint_type(1))) == uint_type(0)) { // a power of two
+            m_range_shift_cache = 0;
+            for (uint_type r = m_value_range_cache; r > uint_type(1); r >>= 1) {
+                m_range_shift_cache++;
+            }
+            m_range_magic_shift_cache = 0;
+        } else {
+            m_range_shift_cache = -1;
+
+            // For other ranges, precompute a Granlund-Montgomery "magic"
+            // reciprocal, so the division may be replaced by a multiply-shift:
+            // with L = ceil(log2(d)) and m = floor(2^(31+L)/d) + 1 we have
+            // (n*m) >> (31+L) == n/d for all dividends 0 <= n < 2^31. Larger
+            // dividends fall back to the plain division in divideByValueRange().
+            if (sizeof(int_type) <= 4) {
+                int L = 0;
+                while ((std::uint64_t(1) << L) < std::uint64_t(m_value_range_cache)) {
+                    L++;
+                }
+                m_range_magic_shift_cache = 31 + L;
+                m_range_magic_cache =
+                    ((std::uint64_t(1) << m_range_magic_shift_cache) / std::uint64_t(m_value_range_cache)) +
+                    std::uint64_t(1);
+            } else {
+                m_range_magic_shift_cache = 0;
+            }
+        }
+    }
+
+    /***************************************************************************/
+    // Cached value-range information, recalculated on demand after boundary changes
+
+    mutable typename std::make_unsigned<int_type>::type m_value_range_cache = 0; ///< The size of the value range; 0 means "invalid"
+    mutable int m_range_shift_cache = -1; ///< log2 of the value range, if it is a power of two; -1 otherwise
+    mutable std::uint64_t m_range_magic_cache = 0; ///< Magic reciprocal for non-power-of-two ranges
+    mutable int m_range_magic_shift_cache = 0; ///< Shift accompanying the magic reciprocal; 0 means "unused"
 };
 
+/******************************************************************************/
+// GConstrainedIntT is only ever used with std::int32_t. The class is
+// explicitly instantiated in GConstrainedIntT.cpp; the declaration below
+// keeps every other translation unit from emitting its member functions.
+extern template class GConstrainedIntT<std::int32_t>;
+
+/******************************************************************************/
+
 } /* namespace Geneva */
 } /* namespace Gem */
 
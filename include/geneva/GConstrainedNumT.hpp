@@ -123,26 +123,7 @@ public:
 			, upperBoundary_(upperBoundary)
 	 {
 		 // Naturally the upper boundary should be > the lower boundary.
-		 if(lowerBoundary_ >= upperBoundary_) {
-			 throw gemfony_exception(
-				 g_error_streamer(DO_LOG, time_and_place)
-					 << "In GConstrainedNumT<T>::GConstrainedNumT(lower,upper):" << std::endl
-					 << "lowerBoundary_ = " << lowerBoundary_ << " is > upperBoundary_ = " << upperBoundary_ << std::endl
-			 );
-		 }
-
-		 // We might have constraints regarding the allowed boundaries. Cross-check
-		 if(lowerBoundary < GConstrainedValueLimitT<T>::lowest() || upperBoundary > GConstrainedValueLimitT<T>::highest()) {
-			 throw gemfony_exception(
-				 g_error_streamer(DO_LOG, time_and_place)
-					 << "In GConstrainedNumT<T>::GConstrainedNumT(lower,upper):" << std::endl
-					 << "lower and/or upper limit outside of allowed value range:" << std::endl
-					 << "lowerBoundary = " << lowerBoundary << std::endl
-					 << "upperBoundary = " << upperBoundary << std::endl
-					 << "GConstrainedValueLimit<T>::lowest()  = " << GConstrainedValueLimitT<T>::lowest() << std::endl
-					 << "GConstrainedValueLimit<T>::highest() = " << GConstrainedValueLimitT<T>::highest() << std::endl
-			 );
-		 }
+		 checkBoundaries(lowerBoundary, upperBoundary, false, "GConstrainedNumT(lower,upper)");
 	 }
 
 	 /***************************************************************************/
@@ -159,38 +140,8 @@ public:
 			, upperBoundary_(upperBoundary)
 	 {
 		 // Do some error checking
-		 if(lowerBoundary_ >= upperBoundary_) {
-			 throw gemfony_exception(
-				 g_error_streamer(DO_LOG, time_and_place)
-					 << "In GConstrainedNumT<T>::GConstrainedNumT(val,lower,upper):" << std::endl
-					 << "lowerBoundary_ = " << lowerBoundary_ << "is >= than" << std::endl
-					 << "upperBoundary_ = " << upperBoundary_ << std::endl
-			 );
-		 }
-
-		 // We might have constraints regarding the allowed boundaries. Cross-check
-		 if(lowerBoundary < GConstrainedValueLimitT<T>::lowest() || upperBoundary > GConstrainedValueLimitT<T>::highest()) {
-			 throw gemfony_exception(
-				 g_error_streamer(DO_LOG, time_and_place)
-					 << "In GConstrainedNumT<T>::GConstrainedNumT(val, lower,upper):" << std::endl
-					 << "lower and/or upper limit outside of allowed value range:" << std::endl
-					 << "lowerBoundary = " << lowerBoundary << std::endl
-					 << "upperBoundary = " << upperBoundary << std::endl
-					 << "GConstrainedValueLimitT<T>::lowest()  = " << GConstrainedValueLimitT<T>::lowest() << std::endl
-					 << "GConstrainedValueLimitT<T>::highest() = " <<  GConstrainedValueLimitT<T>::highest() << std::endl
-			 );
-		 }
-
-		 // Check that the value is inside of the allowed value range
-		 if(val < lowerBoundary_ || val > upperBoundary_) {
-			 throw gemfony_exception(
-				 g_error_streamer(DO_LOG, time_and_place)
-					 << "In GConstrainedNumT<T>::GConstrainedNumT(val,lower,upper):" << std::endl
-					 << "Assigned value " << val << " is outside of its allowed boundaries: " << std::endl
-					 << "lowerBoundary_ = " << lowerBoundary_ << std::endl
-					 << "upperBoundary_ = " << upperBoundary_ << std::endl
-			 );
-		 }
+		 checkBoundaries(lowerBoundary, upperBoundary, false, "GConstrainedNumT(val,lower,upper)");
+		 checkValueRange(val, lowerBoundary_, upperBoundary_, "GConstrainedNumT(val,lower,upper)");
 	 }
 
 	 /***************************************************************************/
@@ -264,39 +215,9 @@ public:
 	 virtual void setBoundaries(const T& lowerBoundary, const T& upperBoundary) BASE {
 		 const T currentValue = this->value(); // Store the externally visible value
 
-		 // Check that the boundaries make sense
-		 if(lowerBoundary > upperBoundary) {
-			 throw gemfony_exception(
-				 g_error_streamer(DO_LOG, time_and_place)
-					 << "In GConstrainedNumT<T>::setBoundaries(const T&, const T&)" << std::endl
-					 << "with typeid(T).name() = " << typeid(T).name() << " :" << std::endl
-					 << "Lower and/or upper boundary has invalid value : " << lowerBoundary << " " << upperBoundary << std::endl
-			 );
-		 }
-
-		 // We might have constraints regarding the allowed boundaries. Cross-check
-		 if(lowerBoundary < GConstrainedValueLimitT<T>::lowest() || upperBoundary > GConstrainedValueLimitT<T>::highest()) {
-			 throw gemfony_exception(
-				 g_error_streamer(DO_LOG, time_and_place)
-					 << "In GConstrainedNumT<T>::setBoundaries(const T&, const T&):" << std::endl
-					 << "lower and/or upper limit outside of allowed value range:" << std::endl
-					 << "lowerBoundary = " << lowerBoundary << std::endl
-					 << "upperBoundary = " << upperBoundary << std::endl
-					 << "GConstrainedValueLimitT<T>::lowest() = " << GConstrainedValueLimitT<T>::lowest() << std::endl
-					 << " GConstrainedValueLimit<T>::highest() = " <<  GConstrainedValueLimitT<T>::highest() << std::endl
-			 );
-		 }
-
-		 // Check that the value is inside the allowed range
-		 if(currentValue < lowerBoundary || currentValue > upperBoundary){
-			 throw gemfony_exception(
-				 g_error_streamer(DO_LOG, time_and_place)
-					 << "In GConstrainedNumT<T>::setBoundaries(const T&, const T&) :" << std::endl
-					 << "with typeid(T).name() = " << typeid(T).name() << std::endl
-					 << "Attempt to set new boundaries [" << lowerBoundary << ":" << upperBoundary << "]" << std::endl
-					 << "with existing value  " << currentValue << " outside of this range." << std::endl
-			 );
-		 }
+		 // Check that the boundaries make sense and that the value is inside of the allowed range
+		 checkBoundaries(lowerBoundary, upperBoundary, true, "setBoundaries(lower,upper)");
+		 checkValueRange(currentValue, lowerBoundary, upperBoundary, "setBoundaries(lower,upper)");
 
 		 lowerBoundary_ = lowerBoundary;
 		 upperBoundary_ = upperBoundary;
@@ -314,8 +235,17 @@ public:
 	  * @param val The new T value stored in this class
 	  */
 	 void setValue(const T& val) override {
-		 // Do some error checking
-		 if(val < lowerBoundary_ || val > upperBoundary_) {
+		 // Do some error checking. Ordinary assignments pass the bounds check,
+		 // so bias the branch accordingly; the throwing block below is treated
+		 // as cold by the compiler in any case. The two comparisons are combined
+		 // without short-circuiting, so the common path contains a single
+		 // predictable branch instead of two.
+		 const bool outOfRange = (val < lowerBoundary_) | (val > upperBoundary_);
+#if defined(__GNUC__)
+		 if(__builtin_expect(outOfRange, false)) {
+#else
+		 if(outOfRange) {
+#endif
 			 throw gemfony_exception(
 				 g_error_streamer(DO_LOG, time_and_place)
 					 << "In GConstrainedNumT<T>::setValue(val):" << std::endl
@@ -344,40 +274,8 @@ public:
 		 , const T& upperBoundary
 	 ) BASE {
 		 // Do some error checking
-
-		 // Do the boundaries make sense ?
-		 if(lowerBoundary > upperBoundary) {
-			 throw gemfony_exception(
-				 g_error_streamer(DO_LOG, time_and_place)
-					 << "In GConstrainedNumT<T>::setValue(val,lower,upper):" << std::endl
-					 << "lowerBoundary_ = " << lowerBoundary_ << "is larger than" << std::endl
-					 << "upperBoundary_ = " << upperBoundary_ << std::endl
-			 );
-		 }
-
-		 // We might have constraints regarding the allowed boundaries. Cross-check
-		 if(lowerBoundary < GConstrainedValueLimitT<T>::lowest() || upperBoundary > GConstrainedValueLimitT<T>::highest()) {
-			 throw gemfony_exception(
-				 g_error_streamer(DO_LOG, time_and_place)
-					 << "In GConstrainedNumT<T>::setValue(val,lower,upper):" << std::endl
-					 << "lower and/or upper limit outside of allowed value range:" << std::endl
-					 << "lowerBoundary = " << lowerBoundary << std::endl
-					 << "upperBoundary = " << upperBoundary << std::endl
-					 << "GConstrainedValueLimitT<T>::lowest() = " << GConstrainedValueLimitT<T>::lowest() << std::endl
-					 << " GConstrainedValueLimit<T>::highest() = " <<  GConstrainedValueLimitT<T>::highest() << std::endl
-			 );
-		 }
-
-		 // Check that the value is inside of the allowed value range
-		 if(val < lowerBoundary || val > upperBoundary) {
-			 throw gemfony_exception(
-				 g_error_streamer(DO_LOG, time_and_place)
-					 << "In GConstrainedNumT<T>::setValue(val,lower,upper):" << std::endl
-					 << "Assigned value = " << val << " is outside of its allowed boundaries: " << std::endl
-					 << "lowerBoundary  = " << lowerBoundary << std::endl
-					 << "upperBoundary  = " << upperBoundary << std::endl
-			 );
-		 }
+		 checkBoundaries(lowerBoundary, upperBoundary, true, "setValue(val,lower,upper)");
+		 checkValueRange(val, lowerBoundary, upperBoundary, "setValue(val,lower,upper)");
 
 		 // O.k., assign the boundaries
 		 lowerBoundary_ = lowerBoundary;
@@ -398,13 +296,18 @@ public:
 	  * @return The transformed value of val_
 	  */
 	 T value() const  override {
-		 T mapping = this->transfer(GParameterT<T>::value());
+		 const T rawValue = GParameterT<T>::value();
+		 T mapping = this->transfer(rawValue);
 
 		 // Reset internal value -- possible because it is declared mutable in
 		 // GParameterT<T>. Resetting the internal value prevents divergence through
 		 // extensive mutation and also speeds up the previous part of the transfer
-		 // function
-		 GParameterT<T>::setValue_(mapping);
+		 // function. The store is skipped when the transfer left the value
+		 // unchanged, so repeated reads of an in-range parameter do not modify
+		 // the object and cannot invalidate its cache line for other cores.
+		 if(mapping != rawValue) {
+			 GParameterT<T>::setValue_(mapping);
+		 }
 
 		 return mapping;
 	 }
@@ -437,16 +340,26 @@ public:
 		 pt::ptree& ptr
 		 , const std::string& baseName
 	 ) const override {
-		 ptr.put(baseName + ".name", this->getParameterName());
-		 ptr.put(baseName + ".type", this->name());
-		 ptr.put(baseName + ".baseType", Gem::Common::GTypeToStringT<T>::value());
-		 ptr.put(baseName + ".isLeaf", this->isLeaf());
-		 ptr.put(baseName + ".nVals", 1);
-		 ptr.put(baseName + ".values.value0", this->value());
-		 ptr.put(baseName + ".lowerBoundary", this->getLowerBoundary());
-		 ptr.put(baseName + ".upperBoundary", this->getUpperBoundary());
-		 ptr.put(baseName + ".initRandom", false); // Unused for the creation of a property tree
-		 ptr.put(baseName + ".adaptionsActive", this->adaptionsActive());
+		 // Each "baseName + suffix" concatenation would allocate a fresh string.
+		 // Re-use a single pre-sized buffer for all path names instead.
+		 std::string path = baseName;
+		 path.reserve(baseName.size() + 16);
+		 auto withSuffix = [&path, &baseName](const char *suffix) -> const std::string& {
+			 path.resize(baseName.size());
+			 path.append(suffix);
+			 return path;
+		 };
+
+		 ptr.put(withSuffix(".name"), this->getParameterName());
+		 ptr.put(withSuffix(".type"), this->name());
+		 ptr.put(withSuffix(".baseType"), Gem::Common::GTypeToStringT<T>::value());
+		 ptr.put(withSuffix(".isLeaf"), this->isLeaf());
+		 ptr.put(withSuffix(".nVals"), 1);
+		 ptr.put(withSuffix(".values.value0"), this->value());
+		 ptr.put(withSuffix(".lowerBoundary"), this->getLowerBoundary());
+		 ptr.put(withSuffix(".upperBoundary"), this->getUpperBoundary());
+		 ptr.put(withSuffix(".initRandom"), false); // Unused for the creation of a property tree
+		 ptr.put(withSuffix(".adaptionsActive"), this->adaptionsActive());
 	 }
 
 protected:
@@ -468,6 +381,19 @@ protected:
 		 upperBoundary_ = p_load->upperBoundary_;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Sets the internal value without re-checking the boundaries. This is meant
+	  * for callers that have already established that the value lies inside of
+	  * the allowed value range, e.g. because it is the result of a transfer()
+	  * call. All other callers should use setValue() instead.
+	  *
+	  * @param val The new value, known to lie inside [lowerBoundary_, upperBoundary_]
+	  */
+	 void setValue_unchecked(const T& val) {
+		 GParameterT<T>::setValue(val);
+	 }
+
 	/***************************************************************************/
 	/** @brief Allow access to this classes compare_ function */
 	friend void Gem::Common::compare_base_t<GConstrainedNumT<T>>(
@@ -553,18 +479,20 @@ protected:
 		// Call the parent classes' functions
 		GParameterT<T>::specificTestsNoFailureExpected_GUnitTests_();
 
+		// A single work object for all checks below. Each block restores it to a
+		// known state through resetBoundaries()/setValue(), so re-cloning per block
+		// would only add allocations and virtual dispatch to the test's runtime.
+		auto p_test = this->template clone_unique<GConstrainedNumT<T>>();
+
 		//------------------------------------------------------------------------------
 
 		{ // Make sure resetting the boundaries results in correct limits
-			// Clone the current object, so we can always recover from failures
-			std::shared_ptr<GConstrainedNumT<T>> p_test = this->template clone<GConstrainedNumT<T>>();
-
 			// Make sure we can freely assign values
 			BOOST_CHECK_NO_THROW(p_test->resetBoundaries());
 			BOOST_CHECK(p_test->getLowerBoundary() == GConstrainedValueLimitT<T>::lowest());
 
 			// GConstrainedDoubleObject assigns the float prior to the specified boundary
-			if(typeid(T) == typeid(double)) {
+			if(std::is_same<T, double>::value) {
 				BOOST_CHECK(double(p_test->getUpperBoundary()) ==  boost::math::float_prior<double>(double(GConstrainedValueLimitT<T>::highest())));
 			} else {
 				BOOST_CHECK(p_test->getUpperBoundary() ==  GConstrainedValueLimitT<T>::highest());
@@ -574,15 +502,13 @@ protected:
 		//------------------------------------------------------------------------------
 
 		{ // Check that assigning a simple, valid value works
-			std::shared_ptr<GConstrainedNumT<T>> p_test = this->template clone<GConstrainedNumT<T>>();
-
 			// Make sure we can freely assign values
 			BOOST_CHECK_NO_THROW(p_test->resetBoundaries());
 
 			// Assign a valid value
 			BOOST_CHECK_NO_THROW(p_test->setValue(testVal));
 
-			if(typeid(T) == typeid(bool)) {
+			if(std::is_same<T, bool>::value) {
 				BOOST_CHECK_NO_THROW(p_test->setValue(true, false, true));
 			} else {
 				BOOST_CHECK_NO_THROW(p_test->setValue(testVal, T(30), T(50)));
@@ -598,8 +524,6 @@ protected:
 		//------------------------------------------------------------------------------
 
 		{ // Test that setting of boundaries with setBoundaries(lower, upper) results in the correct values
-			std::shared_ptr<GConstrainedNumT<T>> p_test = this->template clone<GConstrainedNumT<T>>();
-
 			// Make sure we can freely assign values
 			BOOST_CHECK_NO_THROW(p_test->resetBoundaries());
 
@@ -616,7 +540,7 @@ protected:
 			BOOST_CHECK(p_test->getLowerBoundary() == lowerBoundary);
 
 			// GConstrainedDoubleObject assigns the float prior to the specified boundary
-			if(typeid(T) == typeid(double)) {
+			if(std::is_same<T, double>::value) {
 				BOOST_CHECK(double(p_test->getUpperBoundary()) == boost::math::float_prior<double>(double(upperBoundary)));
 			} else {
 				BOOST_CHECK(p_test->getUpperBoundary() == upperBoundary);
@@ -629,8 +553,6 @@ protected:
 		//------------------------------------------------------------------------------
 
 		{ // Test that setting of boundaries with setValue(val, lower, upper) results in the correct values
-			std::shared_ptr<GConstrainedNumT<T>> p_test = this->template clone<GConstrainedNumT<T>>();
-
 			// Make sure we can freely assign values
 			BOOST_CHECK_NO_THROW(p_test->resetBoundaries());
 
@@ -645,14 +567,14 @@ protected:
 							<< "lowerBoundary = " << lowerBoundary << "\n"
 			);
 
-			if(typeid(T) == typeid(double)) {
+			if(std::is_same<T, double>::value) {
 				BOOST_CHECK_MESSAGE(
 						double(p_test->getUpperBoundary()) == boost::math::float_prior<double>(double(upperBoundary))
 				,  "\n"
 								<< "p_test->getUpperBoundary() = " << p_test->getUpperBoundary() << "\n"
 								<< "upperBoundary = " << upperBoundary << "\n"
 				);
-			} else if(typeid(T) == typeid(float)) {
+			} else if(std::is_same<T, float>::value) {
 				BOOST_CHECK_MESSAGE(
 						float(p_test->getUpperBoundary()) == boost::math::float_prior<float>(float(upperBoundary))
 				,  "\n"
@@ -675,8 +597,6 @@ protected:
 		//------------------------------------------------------------------------------
 
 		{ // Check that assigning a valid value using load results in the correct value
-			std::shared_ptr<GConstrainedNumT<T>> p_test = this->template clone<GConstrainedNumT<T>>();
-
 			// Make sure we can freely assign values
 			BOOST_CHECK_NO_THROW(p_test->resetBoundaries());
 
@@ -709,7 +629,7 @@ protected:
 		//------------------------------------------------------------------------------
 
 		{ // Check that setting invalid boundaries in setBoundaries(lower, upper) throws
-			std::shared_ptr<GConstrainedNumT<T>> p_test = this->template clone<GConstrainedNumT<T>>();
+			auto p_test = this->template clone_unique<GConstrainedNumT<T>>();
 
 			// Setting an upper boundary < lower boundary should throw
 			BOOST_CHECK_THROW(p_test->setBoundaries(T(1), T(0)), gemfony_exception);
@@ -718,7 +638,7 @@ protected:
 		//------------------------------------------------------------------------------
 
 		{ // Check that setting boundaries incompatible with the current value throws
-			std::shared_ptr<GConstrainedNumT<T>> p_test = this->template clone<GConstrainedNumT<T>>();
+			auto p_test = this->template clone_unique<GConstrainedNumT<T>>();
 
 			// First make sure we have the widest possible boundaries
 			BOOST_CHECK_NO_THROW(p_test->resetBoundaries());
@@ -733,7 +653,7 @@ protected:
 		//------------------------------------------------------------------------------
 
 		{ // Check that setting invalid boundaries with setValue(val, lower, upper) throws
-			std::shared_ptr<GConstrainedNumT<T>> p_test = this->template clone<GConstrainedNumT<T>>();
+			auto p_test = this->template clone_unique<GConstrainedNumT<T>>();
 
 			// Setting an upper boundary < lower boundary should throw
 			BOOST_CHECK_THROW(p_test->setValue(T(0), T(2), T(0)), gemfony_exception);
@@ -742,7 +662,7 @@ protected:
 		//------------------------------------------------------------------------------
 
 		{ // Check that setting a value outside of valid boundaries with setValue(val, lower, upper) throws
-			std::shared_ptr<GConstrainedNumT<T>> p_test = this->template clone<GConstrainedNumT<T>>();
+			auto p_test = this->template clone_unique<GConstrainedNumT<T>>();
 
 			// Try to assign a value outside of the allowed boundaries should throw
 			BOOST_CHECK_THROW(p_test->setValue(T(2), T(0), T(1)), gemfony_exception);
@@ -751,7 +671,7 @@ protected:
 		//------------------------------------------------------------------------------
 
 		{ // Check that setting a value outside of the currently assigned boundaries throws
-			std::shared_ptr<GConstrainedNumT<T>> p_test = this->template clone<GConstrainedNumT<T>>();
+			auto p_test = this->template clone_unique<GConstrainedNumT<T>>();
 
 			// Assign a compatible value and boundaries
 			BOOST_CHECK_NO_THROW(p_test->setValue(T(0), T(0), T(1)));
@@ -763,13 +683,13 @@ protected:
 		//------------------------------------------------------------------------------
 
 		{ // Check that assigning a value using operator= outside of the allowed range throws
-			std::shared_ptr<GConstrainedNumT<T>> p_test = this->template clone<GConstrainedNumT<T>>();
+			auto p_test = this->template clone_unique<GConstrainedNumT<T>>();
 
 			// Assign a compatible value and boundaries
 			BOOST_CHECK_NO_THROW(p_test->setValue(T(0), T(0), T(1)));
 
 			// Try to assign 2 as a value - should throw
-			if(typeid(T) != typeid(bool)) {
+			if(not std::is_same<T, bool>::value) {
 				BOOST_CHECK_THROW(*p_test = T(2), gemfony_exception);
 			}
 		}
@@ -797,6 +717,87 @@ private:
 	 /** @brief Creates a deep clone of this object. */
 	 G_API_GENEVA GObject* clone_() const override = 0;
 
+	 /***************************************************************************/
+	 /**
+	  * The boundary validation shared by the constructors, setBoundaries() and
+	  * the setValue() overload that also assigns boundaries. Checks that the
+	  * boundaries are ordered and that they stay inside of the value range
+	  * allowed by GConstrainedValueLimitT<T>. Keeping the checks (and in
+	  * particular the stream-based error emission) out of line means that each
+	  * caller only carries a single function call instead of three inlined
+	  * throw-blocks, across all instantiations of this template.
+	  *
+	  * @param lowerBoundary The candidate lower boundary
+	  * @param upperBoundary The candidate upper boundary
+	  * @param allowEqualBoundaries Whether lowerBoundary == upperBoundary is acceptable
+	  * @param caller The name of the calling function, for error messages
+	  */
+#if defined(__GNUC__)
+	 __attribute__((noinline))
+#endif
+	 static void checkBoundaries(
+		 const T& lowerBoundary
+		 , const T& upperBoundary
+		 , bool allowEqualBoundaries
+		 , const char *caller
+	 ) {
+		 // Naturally the upper boundary should be larger than the lower boundary
+		 if(lowerBoundary > upperBoundary || (not allowEqualBoundaries && lowerBoundary == upperBoundary)) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GConstrainedNumT<T>::" << caller << ":" << std::endl
+					 << "lowerBoundary = " << lowerBoundary << " and" << std::endl
+					 << "upperBoundary = " << upperBoundary << std::endl
+					 << "do not form a valid value range" << std::endl
+			 );
+		 }
+
+		 // We might have constraints regarding the allowed boundaries. Cross-check
+		 if(lowerBoundary < GConstrainedValueLimitT<T>::lowest() || upperBoundary > GConstrainedValueLimitT<T>::highest()) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GConstrainedNumT<T>::" << caller << ":" << std::endl
+					 << "lower and/or upper limit outside of allowed value range:" << std::endl
+					 << "lowerBoundary = " << lowerBoundary << std::endl
+					 << "upperBoundary = " << upperBoundary << std::endl
+					 << "GConstrainedValueLimitT<T>::lowest()  = " << GConstrainedValueLimitT<T>::lowest() << std::endl
+					 << "GConstrainedValueLimitT<T>::highest() = " << GConstrainedValueLimitT<T>::highest() << std::endl
+			 );
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Checks that a value lies inside of a given set of boundaries. Used by the
+	  * same callers as checkBoundaries(), after the boundaries themselves have
+	  * been validated.
+	  *
+	  * @param val The value to be checked
+	  * @param lowerBoundary The lower boundary of the allowed value range
+	  * @param upperBoundary The upper boundary of the allowed value range
+	  * @param caller The name of the calling function, for error messages
+	  */
+#if defined(__GNUC__)
+	 __attribute__((noinline))
+#endif
+	 static void checkValueRange(
+		 const T& val
+		 , const T& lowerBoundary
+		 , const T& upperBoundary
+		 , const char *caller
+	 ) {
+		 if(val < lowerBoundary || val > upperBoundary) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GConstrainedNumT<T>::" << caller << ":" << std::endl
+					 << std::setprecision(20)
+					 << "Assigned value = " << val << " is outside of its allowed boundaries: " << std::endl
+					 << "lowerBoundary = " << lowerBoundary << std::endl
+					 << "upperBoundary = " << upperBoundary << std::endl
+			 );
+		 }
+	 }
+
 	 /***************************************************************************/
 
 	 T lowerBoundary_ = GConstrainedValueLimitT<T>::lowest();  ///< The lower allowed boundary for our value
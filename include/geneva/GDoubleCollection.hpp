@@ -54,7 +54,7 @@ namespace Geneva {
 /**
  * A collection of double objects without boundaries
  */
-class GDoubleCollection
+class GDoubleCollection final
 	:public GFPNumCollectionT<double>
 {
 	 ///////////////////////////////////////////////////////////////////////
@@ -58,7 +58,7 @@ namespace Geneva {
  * as implemented by this library. It is now implemented through a generic
  * base class that can also be used to adapt other numeric types.
  */
-class GDoubleGaussAdaptor
+class GDoubleGaussAdaptor final
     :
         public GFPGaussAdaptorT<double>
 {
@@ -83,21 +83,21 @@ public:
     G_API_GENEVA GDoubleGaussAdaptor(const GDoubleGaussAdaptor &) = default;
 
     /** @brief Initialization with a adaption probability */
-    explicit G_API_GENEVA GDoubleGaussAdaptor(const double &);
+    explicit G_API_GENEVA GDoubleGaussAdaptor(double);
     /** @brief Initialization with a number of values belonging to the width of the gaussian */
     G_API_GENEVA GDoubleGaussAdaptor(
-        const double &
-        , const double &
-        , const double &
-        , const double &
+        double
+        , double
+        , double
+        , double
     );
     /** @brief Initialization with a number of values belonging to the width of the gaussian and the adaption probability */
     G_API_GENEVA GDoubleGaussAdaptor(
-        const double &
-        , const double &
-        , const double &
-        , const double &
-        , const double &
+        double
+        , double
+        , double
+        , double
+        , double
     );
 
     /** @brief The destructor */
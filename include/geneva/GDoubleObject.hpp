@@ -58,7 +58,7 @@ namespace Geneva {
  * use the GDoubleCollection class or individual GConstrainedDoubleObject objects
  * instead.
  */
-class GDoubleObject
+class GDoubleObject final
     : public GNumFPT<double>
 {
     ///////////////////////////////////////////////////////////////////////
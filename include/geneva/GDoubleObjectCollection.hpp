@@ -56,7 +56,7 @@ namespace Geneva {
  * A collection of GDoubleObject objects, ready for use in a
  * GParameterSet derivative.
  */
-class GDoubleObjectCollection
+class GDoubleObjectCollection final
     : public GParameterTCollectionT<GDoubleObject>
 {
     ///////////////////////////////////////////////////////////////////////
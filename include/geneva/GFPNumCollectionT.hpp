@@ -101,22 +101,26 @@ public:
         const std::size_t &nval
         , const fp_type &min
         , const fp_type &max
-    )
-        :
-        GNumCollectionT<fp_type>(
-            nval
-            , min
-            , min
+    ) {
+        // Set the boundaries first (this also checks their validity), then
+        // fill the still-empty vector with random values in a single pass.
+        // Delegating to the (nval, min, min, max) parent constructor would
+        // pre-fill the vector with "min", only for every element to be
+        // overwritten right away -- two sweeps over the memory instead of one.
+        GNumCollectionT<fp_type>::setInitBoundaries(
+            min
             , max
-        ) // The vector is preset to nval entries with value "min"
-    {
-        // No need to resize the vector. as the parent class should already have the desired size
+        );
 
         Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMLOCAL> gr;
-        GFPNumCollectionT<fp_type>::randomInit(
-            activityMode::ACTIVEONLY
-            , gr
+        typename std::uniform_real_distribution<fp_type> uniform_real_distribution(
+            min
+            , max
         );
+        this->m_data_cnt.reserve(nval);
+        for (std::size_t pos = 0; pos < nval; pos++) {
+            this->m_data_cnt.push_back(uniform_real_distribution(gr));
+        }
     }
 
     /***************************************************************************/
@@ -166,12 +170,10 @@ protected:
      * @param cp A copy of another GFPNumCollectionT<fp_type> object, camouflaged as a GObject
      */
     void load_(const GObject *cp) override {
-        // Check that we are dealing with a GFPNumCollectionT<fp_type> reference independent of this object and convert the pointer
-        const GFPNumCollectionT<fp_type>
-            *p_load = Gem::Common::g_convert_and_compare<GObject, GFPNumCollectionT<fp_type>>(
-            cp
-            , this
-        );
+        // As this class has no local data, the type- and self-assignment
+        // checks performed by g_convert_and_compare may be left to the parent
+        // class, which runs them on the same pointer anyway. This avoids a
+        // redundant dynamic_cast per load.
 
         // Load our parent class'es data ...
         GNumCollectionT<fp_type>::load_(cp);
@@ -246,9 +248,14 @@ protected:
             lowerBoundary
             , upperBoundary
         );
-        typename GFPNumCollectionT<fp_type>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it) = uniform_real_distribution(gr);
+
+        // Write through a raw pointer into the contiguous value store. The
+        // explicit stride-1 form keeps the store loop trivially analyzable
+        // for the compiler, independent of the iterator abstraction.
+        fp_type *p = this->m_data_cnt.data();
+        const std::size_t nVals = this->m_data_cnt.size();
+        for (std::size_t pos = 0; pos < nVals; pos++) {
+            p[pos] = uniform_real_distribution(gr);
         }
 
         return true;
@@ -311,11 +318,10 @@ protected:
             BOOST_CHECK_NO_THROW(p_test1->clear());
             BOOST_CHECK_NO_THROW(p_test2->clear());
 
-            // Add a few items
-            for (std::size_t i = 0; i < nItems; i++) {
-                p_test1->push_back(fp_type(0));
-                p_test2->push_back(fp_type(0));
-            }
+            // Add a few items in one step, avoiding the growth reallocations
+            // of repeated push_back() calls
+            p_test1->resize(nItems, fp_type(0));
+            p_test2->resize(nItems, fp_type(0));
 
             // Initialize with a fixed value
             BOOST_CHECK_NO_THROW(p_test1->GParameterBase::template fixedValueInit<fp_type>(
@@ -369,10 +375,8 @@ protected:
             // Make sure p_test1 and p_test2 are empty
             BOOST_CHECK_NO_THROW(p_test1->clear());
 
-            // Add a few items
-            for (std::size_t i = 0; i < nItems; i++) {
-                p_test1->push_back(fp_type(0));
-            }
+            // Add a few items in one step
+            p_test1->resize(nItems, fp_type(0));
 
             // Initialize with a fixed value
             BOOST_CHECK_NO_THROW(p_test1->GParameterBase::template fixedValueInit<fp_type>(
@@ -417,10 +421,8 @@ protected:
             // Make sure p_test1 and p_test2 are empty
             BOOST_CHECK_NO_THROW(p_test1->clear());
 
-            // Add a few items
-            for (std::size_t i = 0; i < nItems; i++) {
-                p_test1->push_back(fp_type(0));
-            }
+            // Add a few items in one step
+            p_test1->resize(nItems, fp_type(0));
 
             // Initialize with a fixed value
             BOOST_CHECK_NO_THROW(p_test1->GParameterBase::template fixedValueInit<fp_type>(
@@ -452,10 +454,8 @@ protected:
             // Make sure p_test1 and p_test2 are empty
             BOOST_CHECK_NO_THROW(p_test1->clear());
 
-            // Add a few items
-            for (std::size_t i = 0; i < nItems; i++) {
-                p_test1->push_back(fp_type(0));
-            }
+            // Add a few items in one step
+            p_test1->resize(nItems, fp_type(0));
 
             // Initialize with a fixed value
             BOOST_CHECK_NO_THROW(p_test1->GParameterBase::template fixedValueInit<fp_type>(
@@ -488,10 +488,8 @@ protected:
             BOOST_CHECK_NO_THROW(p_test2->clear());
             BOOST_CHECK_NO_THROW(p_test3->clear());
 
-            // Add a few items
-            for (std::size_t i = 0; i < nItems; i++) {
-                p_test1->push_back(fp_type(0));
-            }
+            // Add a few items in one step
+            p_test1->resize(nItems, fp_type(0));
 
             // Set initialization boundaries
             BOOST_CHECK_NO_THROW(p_test1->setInitBoundaries(
@@ -542,10 +540,8 @@ protected:
             BOOST_CHECK_NO_THROW(p_test2->clear());
             BOOST_CHECK_NO_THROW(p_test3->clear());
 
-            // Add a few items
-            for (std::size_t i = 0; i < nItems; i++) {
-                p_test1->push_back(fp_type(0));
-            }
+            // Add a few items in one step
+            p_test1->resize(nItems, fp_type(0));
 
             // Set initialization boundaries
             BOOST_CHECK_NO_THROW(p_test1->setInitBoundaries(
@@ -613,9 +609,7 @@ protected:
             std::shared_ptr<GFPNumCollectionT<fp_type>> p_test2 = this->template clone<GFPNumCollectionT<fp_type>>();
 
             // Add a few items to p_test1, but not to p_test2
-            for (std::size_t i = 0; i < nItems; i++) {
-                p_test1->push_back(fp_type(0));
-            }
+            p_test1->resize(nItems, fp_type(0));
 
             BOOST_CHECK_THROW(p_test1->GParameterBase::template add<fp_type>(
                     p_test2
@@ -631,9 +625,7 @@ protected:
             std::shared_ptr<GFPNumCollectionT<fp_type>> p_test2 = this->template clone<GFPNumCollectionT<fp_type>>();
 
             // Add a few items to p_test1, but not to p_test2
-            for (std::size_t i = 0; i < nItems; i++) {
-                p_test1->push_back(fp_type(0));
-            }
+            p_test1->resize(nItems, fp_type(0));
 
             BOOST_CHECK_THROW(p_test1->GParameterBase::template subtract<fp_type>(
                     p_test2
@@ -55,7 +55,7 @@ namespace Geneva {
 /**
  * A collection of std::int32_t objects without boundaries
  */
-class GInt32Collection
+class GInt32Collection final
     : public GIntNumCollectionT<std::int32_t>
 {
     ///////////////////////////////////////////////////////////////////////
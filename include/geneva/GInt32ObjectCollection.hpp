@@ -56,7 +56,7 @@ namespace Geneva {
  * A collection of GInt32Object objects, ready for use in a
  * GParameterSet derivative.
  */
-class GInt32ObjectCollection
+class GInt32ObjectCollection final
     : public GParameterTCollectionT<GInt32Object>
 {
     ///////////////////////////////////////////////////////////////////////
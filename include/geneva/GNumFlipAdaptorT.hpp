@@ -201,7 +201,12 @@ protected:
 
     /***************************************************************************/
     /**
-     * Flip the value up or down by 1, depending on a random number.
+     * Flip the value up or down by 1, depending on a random number. As a fair
+     * coin flip needs just a single random bit, we map the lowest bit of one
+     * raw draw from the generator to +1 or -1 without branching, instead of
+     * running the full bernoulli_distribution machinery and branching on its
+     * outcome for every adapted value. The base generator's min() is 0, so
+     * the lowest bit is unbiased.
      *
      * @param value The bit value to be adapted
      * @param range A typical range for the parameter with type T (unused here)
@@ -211,16 +216,7 @@ protected:
         , const num_type &range
         , Gem::Hap::GRandomBase &gr
     ) override {
-        using namespace Gem::Common;
-        using namespace Gem::Hap;
-
-        if (GAdaptorT<num_type>::m_weighted_bool(
-            gr
-            , std::bernoulli_distribution::param_type(0.5))) {
-            value += 1;
-        } else {
-            value -= 1;
-        }
+        value += 1 - 2 * static_cast<int>(gr() & 1);
     }
 
     /* ----------------------------------------------------------------------------------
@@ -206,15 +206,14 @@ public:
             baseName + ".nVals"
             , this->size());
 
+        // The common key prefix does not change inside the loop, so it is built
+        // only once instead of re-concatenated for every value
+        const std::string valueBaseName = baseName + "values.value";
         typename GParameterCollectionT<num_type>::const_iterator cit;
-        std::size_t pos;
+        std::size_t pos = 0;
         for (cit = this->begin(); cit != this->end(); ++cit) {
-            pos = std::distance(
-                this->begin()
-                , cit
-            );
             ptr.put(
-                baseName + "values.value" + Gem::Common::to_string(pos)
+                valueBaseName + Gem::Common::to_string(pos++)
                 , *cit
             );
         }
@@ -54,7 +54,6 @@
 #include "common/GCommonHelperFunctionsT.hpp"
 #include "common/GCommonMathHelperFunctions.hpp"
 #include "common/GLogger.hpp"
-#include "common/GCommonHelperFunctionsT.hpp"
 #include "common/GPtrVectorT.hpp"
 #include "hap/GRandomT.hpp"
 #include "courtier/GProcessingContainerT.hpp"
@@ -64,7 +63,6 @@
 #include "geneva/GPersonalityTraits.hpp"
 #include "geneva/G_Interface_Mutable.hpp"
 #include "geneva/G_Interface_Rateable.hpp"
-#include "geneva/GPersonalityTraits.hpp"
 #include "geneva/GMultiConstraintT.hpp"
 
 #ifdef GEM_TESTING
@@ -614,6 +612,11 @@ public:
         // Make sure the vector is clean
         parVec.clear();
 
+        // Reserve the target size up-front, so the per-object insertions below
+        // do not trigger repeated reallocations. Counting is cheap -- the value
+        // collections answer it from their size().
+        parVec.reserve(this->countParameters<par_type>(am));
+
         // Loop over all GParameterBase objects.
         for (const auto &parm_ptr: *this) {
             parm_ptr->streamline<par_type>(
@@ -746,6 +749,12 @@ public:
         lBndVec.clear();
         uBndVec.clear();
 
+        // Both vectors will receive one entry per matching parameter --
+        // reserving up front avoids repeated reallocations while they fill up
+        const std::size_t nPars = this->countParameters<par_type>(am);
+        lBndVec.reserve(nPars);
+        uBndVec.reserve(nPars);
+
         // Loop over all GParameterBase objects.
         for (const auto &parm_ptr: *this) {
             parm_ptr->boundaries<par_type>(
@@ -172,14 +172,13 @@ public:
             , this->size());
 
         // Loop over all parameter objects and ask them to add their
-        // data to our ptree object
+        // data to our ptree object. The common key prefix is built just once.
+        const std::string valueBaseName = baseName + ".values.value";
         std::string base;
-        std::size_t pos;
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            pos = cit - this->begin();
-            base = baseName + ".values.value" + Gem::Common::to_string(pos);
-            (*cit)->toPropertyTree(
+        std::size_t pos = 0;
+        for (const auto &item_ptr: *this) {
+            base = valueBaseName + Gem::Common::to_string(pos++);
+            item_ptr->toPropertyTree(
                 ptr
                 , base
             );
@@ -270,12 +269,11 @@ protected:
     ) override {
         bool randomized = false;
 
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
+        for (const auto &item_ptr: *this) {
             // Note that we do not call the randomInit_() function. First of all, we
             // do not have access to it. Secondly it might be that re-initialization of
             // a specific object is not desired.
-            if ((*it)->GParameterBase::randomInit(
+            if (item_ptr->GParameterBase::randomInit(
                 am
                 , gr
             )) {
@@ -297,9 +295,8 @@ protected:
         std::vector<float> &parVec
         , const activityMode &am
     ) const override {
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            (*cit)->template streamline<float>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template streamline<float>(
                 parVec
                 , am
             );
@@ -322,9 +319,8 @@ protected:
         std::vector<double> &parVec
         , const activityMode &am
     ) const override {
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            (*cit)->template streamline<double>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template streamline<double>(
                 parVec
                 , am
             );
@@ -347,9 +343,8 @@ protected:
         std::vector<std::int32_t> &parVec
         , const activityMode &am
     ) const override {
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            (*cit)->template streamline<std::int32_t>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template streamline<std::int32_t>(
                 parVec
                 , am
             );
@@ -372,9 +367,8 @@ protected:
         std::vector<bool> &parVec
         , const activityMode &am
     ) const override {
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            (*cit)->template streamline<bool>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template streamline<bool>(
                 parVec
                 , am
             );
@@ -397,9 +391,8 @@ protected:
         std::map<std::string, std::vector<float>> &parVec
         , const activityMode &am
     ) const override {
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            (*cit)->template streamline<float>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template streamline<float>(
                 parVec
                 , am
             );
@@ -422,9 +415,8 @@ protected:
         std::map<std::string, std::vector<double>> &parVec
         , const activityMode &am
     ) const override {
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            (*cit)->template streamline<double>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template streamline<double>(
                 parVec
                 , am
             );
@@ -447,9 +439,8 @@ protected:
         std::map<std::string, std::vector<std::int32_t>> &parVec
         , const activityMode &am
     ) const override {
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            (*cit)->template streamline<std::int32_t>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template streamline<std::int32_t>(
                 parVec
                 , am
             );
@@ -472,9 +463,8 @@ protected:
         std::map<std::string, std::vector<bool>> &parVec
         , const activityMode &am
     ) const override {
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            (*cit)->template streamline<bool>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template streamline<bool>(
                 parVec
                 , am
             );
@@ -498,9 +488,8 @@ protected:
         , std::vector<float> &uBndVec
         , const activityMode &am
     ) const override {
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            (*cit)->template boundaries<float>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template boundaries<float>(
                 lBndVec
                 , uBndVec
                 , am
@@ -520,9 +509,8 @@ protected:
         , std::vector<double> &uBndVec
         , const activityMode &am
     ) const override {
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            (*cit)->template boundaries<double>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template boundaries<double>(
                 lBndVec
                 , uBndVec
                 , am
@@ -542,9 +530,8 @@ protected:
         , std::vector<std::int32_t> &uBndVec
         , const activityMode &am
     ) const override {
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            (*cit)->template boundaries<std::int32_t>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template boundaries<std::int32_t>(
                 lBndVec
                 , uBndVec
                 , am
@@ -567,9 +554,8 @@ protected:
         , std::vector<bool> &uBndVec
         , const activityMode &am
     ) const override {
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            (*cit)->template boundaries<bool>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template boundaries<bool>(
                 lBndVec
                 , uBndVec
                 , am
@@ -590,9 +576,8 @@ protected:
     ) const override {
         std::size_t result = 0;
 
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            result += (*cit)->template countParameters<float>(am);
+        for (const auto &item_ptr: *this) {
+            result += item_ptr->template countParameters<float>(am);
         }
 
         return result;
@@ -611,9 +596,8 @@ protected:
     ) const override {
         std::size_t result = 0;
 
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            result += (*cit)->template countParameters<double>(am);
+        for (const auto &item_ptr: *this) {
+            result += item_ptr->template countParameters<double>(am);
         }
 
         return result;
@@ -632,9 +616,8 @@ protected:
     ) const override {
         std::size_t result = 0;
 
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            result += (*cit)->template countParameters<std::int32_t>(am);
+        for (const auto &item_ptr: *this) {
+            result += item_ptr->template countParameters<std::int32_t>(am);
         }
 
         return result;
@@ -653,9 +636,8 @@ protected:
     ) const override {
         std::size_t result = 0;
 
-        typename GParameterTCollectionT<T>::const_iterator cit;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            result += (*cit)->template countParameters<bool>(am);
+        for (const auto &item_ptr: *this) {
+            result += item_ptr->template countParameters<bool>(am);
         }
 
         return result;
@@ -670,9 +652,8 @@ protected:
         , std::size_t &pos
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template assignValueVector<float>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template assignValueVector<float>(
                 parVec
                 , pos
                 , am
@@ -694,9 +675,8 @@ protected:
         , std::size_t &pos
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template assignValueVector<double>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template assignValueVector<double>(
                 parVec
                 , pos
                 , am
@@ -718,9 +698,8 @@ protected:
         , std::size_t &pos
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template assignValueVector<std::int32_t>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template assignValueVector<std::int32_t>(
                 parVec
                 , pos
                 , am
@@ -742,9 +721,8 @@ protected:
         , std::size_t &pos
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template assignValueVector<bool>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template assignValueVector<bool>(
                 parVec
                 , pos
                 , am
@@ -765,9 +743,8 @@ protected:
         const std::map<std::string, std::vector<float>> &parMap
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template assignValueVectors<float>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template assignValueVectors<float>(
                 parMap
                 , am
             );
@@ -787,9 +764,8 @@ protected:
         const std::map<std::string, std::vector<double>> &parMap
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template assignValueVectors<double>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template assignValueVectors<double>(
                 parMap
                 , am
             );
@@ -809,9 +785,8 @@ protected:
         const std::map<std::string, std::vector<std::int32_t>> &parMap
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template assignValueVectors<std::int32_t>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template assignValueVectors<std::int32_t>(
                 parMap
                 , am
             );
@@ -831,9 +806,8 @@ protected:
         const std::map<std::string, std::vector<bool>> &parMap
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template assignValueVectors<bool>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template assignValueVectors<bool>(
                 parMap
                 , am
             );
@@ -855,9 +829,8 @@ protected:
         , const activityMode &am
         , Gem::Hap::GRandomBase &gr
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template multiplyByRandom<float>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template multiplyByRandom<float>(
                 min
                 , max
                 , am
@@ -876,9 +849,8 @@ protected:
         , const activityMode &am
         , Gem::Hap::GRandomBase &gr
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template multiplyByRandom<double>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template multiplyByRandom<double>(
                 min
                 , max
                 , am
@@ -897,9 +869,8 @@ protected:
         , const activityMode &am
         , Gem::Hap::GRandomBase &gr
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template multiplyByRandom<std::int32_t>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template multiplyByRandom<std::int32_t>(
                 min
                 , max
                 , am
@@ -916,9 +887,8 @@ protected:
         const activityMode &am
         , Gem::Hap::GRandomBase &gr
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template multiplyByRandom<float>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template multiplyByRandom<float>(
                 am
                 , gr
             );
@@ -933,9 +903,8 @@ protected:
         const activityMode &am
         , Gem::Hap::GRandomBase &gr
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template multiplyByRandom<double>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template multiplyByRandom<double>(
                 am
                 , gr
             );
@@ -950,9 +919,8 @@ protected:
         const activityMode &am
         , Gem::Hap::GRandomBase &gr
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template multiplyByRandom<std::int32_t>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template multiplyByRandom<std::int32_t>(
                 am
                 , gr
             );
@@ -967,9 +935,8 @@ protected:
         const float &value
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template multiplyBy<float>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template multiplyBy<float>(
                 value
                 , am
             );
@@ -984,9 +951,8 @@ protected:
         const double &value
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template multiplyBy<double>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template multiplyBy<double>(
                 value
                 , am
             );
@@ -1001,9 +967,8 @@ protected:
         const std::int32_t &value
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template multiplyBy<std::int32_t>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template multiplyBy<std::int32_t>(
                 value
                 , am
             );
@@ -1018,9 +983,8 @@ protected:
         const float &value
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template fixedValueInit<float>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template fixedValueInit<float>(
                 value
                 , am
             );
@@ -1035,9 +999,8 @@ protected:
         const double &value
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template fixedValueInit<double>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template fixedValueInit<double>(
                 value
                 , am
             );
@@ -1052,9 +1015,8 @@ protected:
         const std::int32_t &value
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template fixedValueInit<std::int32_t>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template fixedValueInit<std::int32_t>(
                 value
                 , am
             );
@@ -1069,9 +1031,8 @@ protected:
         const bool &value
         , const activityMode &am
     ) override {
-        typename GParameterTCollectionT<T>::iterator it;
-        for (it = this->begin(); it != this->end(); ++it) {
-            (*it)->template fixedValueInit<bool>(
+        for (const auto &item_ptr: *this) {
+            item_ptr->template fixedValueInit<bool>(
                 value
                 , am
             );
@@ -48,7 +48,6 @@
 // Geneva headers go here
 #include "common/GExceptions.hpp"
 #include "common/GCommonHelperFunctionsT.hpp"
-#include "common/GPlotDesigner.hpp"
 #include "geneva/GOptimizationEnums.hpp"
 #include "geneva/GParameterSet.hpp"
 #include "geneva/G_OptimizationAlgorithm_ParChild.hpp"
@@ -211,6 +210,8 @@ private:
     G_API_GENEVA void sortMuCommaNuMode();
     /** @brief Selection, MUNU1PRETAIN_SINGLEEVAL style */
     G_API_GENEVA void sortMunu1pretainMode();
+    /** @brief Partially sorts part of the population on a flat buffer of cached fitness values */
+    G_API_GENEVA void sortRangeOnCachedFitness(std::size_t first, std::size_t middle);
 
     /** @brief Selection according to the pareto tag, also taking into account the parents of a population (i.e. in MUPLUSNU mode). */
     G_API_GENEVA void sortMuPlusNuParetoMode();
@@ -68,6 +68,7 @@ namespace Geneva {
 const std::size_t DEFAULTGDSTARTINGPOINTS = 1;
 const double DEFAULTFINITESTEP = 0.001;
 const double DEFAULTSTEPSIZE = 0.1;
+const double DEFAULTGDMOMENTUM = 0.; ///< By default no momentum is applied, resulting in plain steepest descent
 
 /******************************************************************************/
 /**
@@ -95,7 +96,8 @@ class GGradientDescent
         & BOOST_SERIALIZATION_NVP(nStartingPoints_)
         & BOOST_SERIALIZATION_NVP(nFPParmsFirst_)
         & BOOST_SERIALIZATION_NVP(finiteStep_)
-        & BOOST_SERIALIZATION_NVP(stepSize_);
+        & BOOST_SERIALIZATION_NVP(stepSize_)
+        & BOOST_SERIALIZATION_NVP(momentum_);
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -125,6 +127,11 @@ public:
     /** @brief Retrieves the current step size */
     G_API_GENEVA double getStepSize() const;
 
+    /** @brief Sets the weight given to the preceding step of each parent */
+    G_API_GENEVA void setMomentum(double);
+    /** @brief Retrieves the weight given to the preceding step of each parent */
+    G_API_GENEVA double getMomentum() const;
+
 protected:
     /***************************************************************************/
     // Virtual or overridden protected functions
@@ -212,6 +219,7 @@ private:
 
     double finiteStep_ = DEFAULTFINITESTEP; ///< The size of the incremental adaption of the feature vector
     double stepSize_ = DEFAULTSTEPSIZE; ///< A multiplicative factor for the adaption
+    double momentum_ = DEFAULTGDMOMENTUM; ///< The weight given to the preceding step of each parent; 0 yields plain steepest descent
     long double stepRatio_ = (
         DEFAULTSTEPSIZE / DEFAULTFINITESTEP
     ); ///< The ratio of stepSize_ and finiteStep_. NOTE: long double; Will be recalculated in init()
@@ -222,6 +230,8 @@ private:
         = std::vector<double>(); ///< Holds upper boundaries of double parameters; Will be extracted in init()
     std::vector<double> adjustedFiniteStep_
         = std::vector<double>(); ///< A step-size normalized to each parameter range; Will be recalculated in init()
+    std::vector<double> prevStep_
+        = std::vector<double>(); ///< The step last taken in each direction of each parent; Will be resized in init()
 
     /** @brief Lets individuals know about their position in the population */
     void markIndividualPositions();
@@ -40,12 +40,11 @@
 #include "common/GGlobalDefines.hpp"
 
 // Standard headers go here
+#include <algorithm>
 #include <type_traits>
 #include <tuple>
 
 // Boost headers go here
-#include <boost/filesystem.hpp>
-#include <boost/filesystem/fstream.hpp>
 
 // Geneva headers go here
 #include "common/GExceptions.hpp"
@@ -119,8 +118,29 @@ public:
 
     /** @brief Retrieve the number of parents as set by the user */
     G_API_GENEVA std::size_t getNParents() const;
-    /** @brief Calculates the current number of children from the number of parents and the size of the vector. */
-    G_API_GENEVA std::size_t getNChildren() const;
+    /***************************************************************************/
+    /**
+     * Calculates the current number of children from the number of parents and
+     * the size of the vector. Defined inline so callers do not pay a function
+     * call for what amounts to two loads and a subtraction. The value is
+     * deliberately not cached in a member: the population size may be changed
+     * through the inherited container interface, which this class does not
+     * intercept, so a cache could silently go stale.
+     *
+     * @return The number of children in the population
+     */
+    std::size_t getNChildren() const {
+        std::size_t popSize = this->size();
+        if(popSize <= m_n_parents) {
+            // This will happen, when only the default population size has been set,
+            // but no individuals have been added yet
+            return 0;
+        } else {
+            return popSize - m_n_parents;
+        }
+    }
+
+    /***************************************************************************/
     /** @brief Retrieves the defaultNChildren_ parameter */
     G_API_GENEVA std::size_t getDefaultNChildren() const;
 
@@ -240,6 +260,8 @@ protected:
     G_API_GENEVA void markChildren();
     /** @brief This helper function lets all individuals know about their position in the population. */
     G_API_GENEVA void markIndividualPositions();
+    /** @brief This helper function marks children and individual positions in a single pass */
+    G_API_GENEVA void markChildrenAndPositions();
 
     /** @brief Increases the population size if requested by the user */
     G_API_GENEVA void performScheduledPopulationGrowth();
@@ -254,14 +276,19 @@ protected:
 
     /***************************************************************************/
 
+    // Note: the wide (8 byte) members are kept together, with the 2-byte
+    // duplicationScheme enum at the end of the block, so the algorithm state
+    // packs without internal padding. Archives are unaffected, as
+    // Boost.Serialization stores members by name in the order given in
+    // serialize(), not in declaration order.
     std::size_t m_n_parents = DEFPARCHILDNPARENTS; ///< The number of parents
-    duplicationScheme m_recombination_method = duplicationScheme::DEFAULTDUPLICATIONSCHEME; ///< The chosen recombination method
     std::size_t m_default_n_children = DEFPARCHILDNCHILDREN; ///< Expected number of children
     std::size_t m_growth_rate = 0; ///< Specifies the amount of individuals added per iteration
     std::size_t m_max_population_size
         = 0; ///< Specifies the maximum amount of individuals in the population if growth is enabled
     double m_amalgamationLikelihood
         = DEFAULTAMALGAMATIONLIKELIHOOD; ///< Likelihood for children to be created by cross-over rather than "just" duplication (note that they may nevertheless be mutated)
+    duplicationScheme m_recombination_method = duplicationScheme::DEFAULTDUPLICATIONSCHEME; ///< The chosen recombination method
 
 private:
     /***************************************************************************/
@@ -254,8 +254,8 @@ protected:
 	 G_API_GENEVA void updateIndividualPositions(
 		 const std::size_t&
 		 , std::shared_ptr<GParameterSet>
-		 , std::shared_ptr<GParameterSet>
-		 , std::shared_ptr<GParameterSet>
+		 , const std::vector<double>& // the neighborhood best's parameters
+		 , const std::vector<double>& // the globally best individual's parameters
 		 , std::shared_ptr<GParameterSet>
 		 , std::tuple<double, double, double, double>
 	 );
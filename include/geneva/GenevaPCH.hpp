@@ -0,0 +1,57 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+/******************************************************************************/
+/**
+ * A precompiled-header aggregate for the Geneva library. Every translation
+ * unit of the geneva target includes GObject.hpp (and thereby the standard
+ * library, Boost.Serialization and the common-library headers) either
+ * directly or through the class it implements, so parsing that set once per
+ * build instead of once per translation unit removes the bulk of the
+ * frontend cost. The header is only attached to the build where CMake
+ * supports precompiled headers (>= 3.16, see src/geneva/CMakeLists.txt);
+ * source files must not include it directly.
+ *
+ * Boost.Test deliberately stays out of this aggregate: it is only pulled in
+ * by GEM_TESTING builds, and its inclusion is governed by the individual
+ * headers.
+ */
+
+#include "geneva/GObject.hpp"
+
+/******************************************************************************/
@@ -85,8 +85,19 @@ public:
 	 G_API_HAP GRandomBase();
 	 /** @brief A standard destructor */
 	 virtual G_API_HAP ~GRandomBase();
-	 /** @brief Retrieves a "raw" random item item */
-	 G_API_HAP GRandomBase::result_type operator()();
+	 /***************************************************************************/
+	 /**
+	  * Retrieves a "raw" random item. This function, together with the min()
+	  * and max() functions make it possible to use GRandomBase as a generator
+	  * for the C++11 standard random distributions. It is defined inline, as
+	  * the distributions may call it several times per variate -- this way
+	  * only the unavoidable virtual generator call remains un-inlined.
+	  *
+	  * @return A "raw" random number suitable for a C++11 standard random engine
+	  */
+	 result_type operator()() {
+		 return this->int_random();
+	 }
 
 	/***************************************************************************/
 	// Prevent copying
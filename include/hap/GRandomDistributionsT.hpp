@@ -40,8 +40,10 @@
 #include "common/GGlobalDefines.hpp"
 
 // Standard headers go here
+#include <cstdint>
 #include <random>
 #include <limits>
+#include <type_traits>
 
 // Boost headers go here
 
@@ -338,6 +340,61 @@ bool operator!=(
 	return lhs.param() != rhs.param();
 };
 
+/******************************************************************************/
+/**
+ * Draws a uniformly distributed integer from [lo, up] (both boundaries
+ * included). For integer types of up to 32 bits and generators emitting full
+ * 32 bit words -- which includes the Gem::Hap generators, backed by
+ * std::mt19937 -- this uses Lemire's multiply-shift technique: one raw draw,
+ * one 64 bit multiplication and only a rarely taken rejection loop, instead of
+ * the divisions std::uniform_int_distribution performs on every call. Other
+ * type/generator combinations fall back to the standard distribution.
+ *
+ * @param g The generator random words should be drawn from
+ * @param lo The lower boundary of the value range
+ * @param up The upper boundary of the value range (included)
+ * @return A uniformly distributed integer from [lo, up]
+ */
+template <
+	typename int_type
+	, typename T_Generator
+	, typename std::enable_if<std::is_integral<int_type>::value>::type* dummy = nullptr
+>
+int_type g_uniform_int(
+	T_Generator& g
+	, const int_type& lo
+	, const int_type& up
+) {
+	if(sizeof(int_type) <= 4
+		&& (T_Generator::min)() == 0
+		&& (T_Generator::max)() == std::numeric_limits<std::uint32_t>::max()
+	) {
+		// The number of values in the range; wraps to 0 when the range spans
+		// all of the 32 bit space, in which case the raw word is the result
+		const std::uint32_t s = std::uint32_t(up) - std::uint32_t(lo) + 1u;
+		std::uint32_t x = std::uint32_t(g());
+		if(s == 0u) {
+			return int_type(std::uint32_t(lo) + x);
+		}
+
+		std::uint64_t m = std::uint64_t(x) * std::uint64_t(s);
+		std::uint32_t l = std::uint32_t(m);
+		if(l < s) { // possibly in the biased region -- almost never taken
+			const std::uint32_t t = (0u - s) % s; // 2^32 mod s
+			while(l < t) {
+				x = std::uint32_t(g());
+				m = std::uint64_t(x) * std::uint64_t(s);
+				l = std::uint32_t(m);
+			}
+		}
+
+		return int_type(std::uint32_t(lo) + std::uint32_t(m >> 32));
+	}
+
+	typename std::uniform_int_distribution<int_type> uniform_int(lo, up);
+	return uniform_int(g);
+}
+
 /******************************************************************************/
 
 } /* namespace Hap */
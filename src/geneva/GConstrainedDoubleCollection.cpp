@@ -118,9 +118,21 @@ std::string GConstrainedDoubleCollection::name_() const {
 void GConstrainedDoubleCollection::doubleStreamline(
 	std::vector<double> &parVec, const activityMode &am
 ) const {
+	// The boundaries apply to all entries of the collection alike, so they are
+	// retrieved only once. Values inside the allowed range map to themselves,
+	// hence the virtual transfer() call is only needed for the (rare) entries
+	// outside of the range, and the common case degenerates to a plain copy.
+	const double lowerBoundary = this->getLowerBoundary();
+	const double upperBoundary = this->getUpperBoundary();
+
+	parVec.reserve(parVec.size() + this->size());
 	GConstrainedDoubleCollection::const_iterator cit;
 	for (cit = this->begin(); cit != this->end(); ++cit) {
-		parVec.push_back(this->transfer(*cit));
+		if (*cit >= lowerBoundary && *cit < upperBoundary) {
+			parVec.push_back(*cit);
+		} else {
+			parVec.push_back(this->transfer(*cit));
+		}
 	}
 }
 
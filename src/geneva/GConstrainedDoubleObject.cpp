@@ -214,7 +214,7 @@ void GConstrainedDoubleObject::assignDoubleValueVector(
 	}
 #endif
 
-	this->setValue(this->transfer(parVec[pos]));
+	this->setValue_unchecked(this->transfer(parVec[pos]));
 	pos++;
 }
 
@@ -225,7 +225,7 @@ void GConstrainedDoubleObject::assignDoubleValueVector(
 void GConstrainedDoubleObject::assignDoubleValueVectors(
 	const std::map<std::string, std::vector<double>> &parMap, const activityMode &am
 ) {
-	this->setValue(
+	this->setValue_unchecked(
 		this->transfer(
 			Gem::Common::getMapItem(
 				parMap
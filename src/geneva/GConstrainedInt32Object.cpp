@@ -212,7 +212,7 @@ void GConstrainedInt32Object::assignInt32ValueVector(
 	}
 #endif
 
-	this->setValue(this->transfer(parVec[pos]));
+	this->setValue_unchecked(this->transfer(parVec[pos]));
 	pos++;
 }
 
@@ -223,7 +223,7 @@ void GConstrainedInt32Object::assignInt32ValueVector(
 void GConstrainedInt32Object::assignInt32ValueVectors(
 	const std::map<std::string, std::vector<std::int32_t>> &parMap, const activityMode &am
 ) {
-	this->setValue(
+	this->setValue_unchecked(
 		this->transfer(
 			Gem::Common::getMapItem(
 				parMap, this->getParameterName()
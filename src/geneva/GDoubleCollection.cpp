@@ -246,11 +246,12 @@ void GDoubleCollection::doubleMultiplyByRandom(
 	, Gem::Hap::GRandomBase& gr
 ) {
 	std::uniform_real_distribution<double> uniform_real_distribution(min,max);
-	for (std::size_t pos = 0; pos < this->size(); pos++) {
-		GParameterCollectionT<double>::setValue(
-			pos
-			, this->value(pos) * uniform_real_distribution(gr)
-		);
+	// As no value transformation takes place in this class, we may work on the
+	// underlying array directly instead of going through the virtual
+	// value()/setValue() accessors for every single entry. The random numbers
+	// themselves are produced in batches by the Gem::Hap random factory.
+	for (auto &val: *this) {
+		val *= uniform_real_distribution(gr);
 	}
 }
 
@@ -263,11 +264,10 @@ void GDoubleCollection::doubleMultiplyByRandom(
 	, Gem::Hap::GRandomBase& gr
 ) {
 	std::uniform_real_distribution<double> uniform_real_distribution(0., 1.);
-	for (std::size_t pos = 0; pos < this->size(); pos++) {
-		GParameterCollectionT<double>::setValue(
-			pos
-			, this->value(pos) * uniform_real_distribution(gr)
-		);
+	// See the comment in the range-variant of this function -- direct access to
+	// the underlying array avoids per-element virtual dispatch
+	for (auto &val: *this) {
+		val *= uniform_real_distribution(gr);
 	}
 }
 
@@ -279,8 +279,10 @@ void GDoubleCollection::doubleMultiplyBy(
 	const double &val
 	, const activityMode &am
 ) {
-	for (std::size_t pos = 0; pos < this->size(); pos++) {
-		GParameterCollectionT<double>::setValue(pos, val * this->value(pos));
+	// See the comment in doubleMultiplyByRandom() -- direct access to the
+	// underlying array yields a contiguous loop without per-element range checks
+	for (auto &item: *this) {
+		item *= val;
 	}
 }
 
@@ -291,8 +293,9 @@ void GDoubleCollection::doubleMultiplyBy(
 void GDoubleCollection::doubleFixedValueInit(
 	const double &val, const activityMode &am
 ) {
-	for (std::size_t pos = 0; pos < this->size(); pos++) {
-		GParameterCollectionT<double>::setValue(pos, val);
+	// A contiguous fill, for the same reason as in doubleMultiplyBy()
+	for (auto &item: *this) {
+		item = val;
 	}
 }
 
@@ -315,8 +318,11 @@ void GDoubleCollection::doubleAdd(
 				<< "Sizes of vectors don't match: " << this->size() << "/" << p->size() << std::endl );
 	}
 
-	for(std::size_t pos = 0; pos<this->size(); pos++) {
-		GParameterCollectionT<double>::setValue(pos, this->value(pos) + p->value(pos));
+	// Both operands expose their values contiguously, so the sum may run over
+	// the two arrays in lock-step without per-element range checks
+	const std::size_t nVals = this->size();
+	for(std::size_t pos = 0; pos<nVals; pos++) {
+		(*this)[pos] += (*p)[pos];
 	}
 }
 
@@ -340,8 +346,10 @@ activityMode &am
 		);
 	}
 
-	for(std::size_t pos = 0; pos<this->size(); pos++) {
-		GParameterCollectionT<double>::setValue(pos, this->value(pos) - p->value(pos));
+	// See the comment in doubleAdd()
+	const std::size_t nVals = this->size();
+	for(std::size_t pos = 0; pos<nVals; pos++) {
+		(*this)[pos] -= (*p)[pos];
 	}
 }
 
@@ -47,7 +47,7 @@ namespace Geneva {
  *
  * @param adProb The adaption probability
  */
-GDoubleGaussAdaptor::GDoubleGaussAdaptor(const double &adProb)
+GDoubleGaussAdaptor::GDoubleGaussAdaptor(double adProb)
 	: GFPGaussAdaptorT<double>(adProb) { /* nothing */ }
 
 /********************************************************************************************/
@@ -60,7 +60,7 @@ GDoubleGaussAdaptor::GDoubleGaussAdaptor(const double &adProb)
  * @param maxSigma The maximal value allowed for sigma_
  */
 GDoubleGaussAdaptor::GDoubleGaussAdaptor(
-	const double &sigma, const double &sigmaSigma, const double &minSigma, const double &maxSigma
+	double sigma, double sigmaSigma, double minSigma, double maxSigma
 )
 	: GFPGaussAdaptorT<double>(sigma, sigmaSigma, minSigma, maxSigma) { /* nothing */ }
 
@@ -76,7 +76,7 @@ GDoubleGaussAdaptor::GDoubleGaussAdaptor(
  * @param adProb The adaption probability
  */
 GDoubleGaussAdaptor::GDoubleGaussAdaptor(
-	const double &sigma, const double &sigmaSigma, const double &minSigma, const double &maxSigma, const double &adProb
+	double sigma, double sigmaSigma, double minSigma, double maxSigma, double adProb
 )
 	: GFPGaussAdaptorT<double>(sigma, sigmaSigma, minSigma, maxSigma, adProb) { /* nothing */ }
 
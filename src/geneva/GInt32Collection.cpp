@@ -125,10 +125,9 @@ std::string GInt32Collection::name_() const {
 void GInt32Collection::int32Streamline(
 	std::vector<std::int32_t> &parVec, const activityMode &am
 ) const {
-	GInt32Collection::const_iterator cit;
-	for (cit = this->begin(); cit != this->end(); ++cit) {
-		parVec.push_back(*cit);
-	}
+	// A single bulk insert lets the vector size the target once and copy the
+	// contiguous value block in one sweep
+	parVec.insert(parVec.end(), this->begin(), this->end());
 }
 
 /******************************************************************************/
@@ -167,13 +166,11 @@ void GInt32Collection::int32Streamline(
 void GInt32Collection::int32Boundaries(
 	std::vector<std::int32_t> &lBndVec, std::vector<std::int32_t> &uBndVec, const activityMode &am
 ) const {
-	// Add as man lower and upper boundaries to the vector as
-	// there are variables
-	GInt32Collection::const_iterator cit;
-	for (cit = this->begin(); cit != this->end(); ++cit) {
-		lBndVec.push_back(this->getLowerInitBoundary());
-		uBndVec.push_back(this->getUpperInitBoundary());
-	}
+	// Add as many lower and upper boundaries to the vector as there are
+	// variables. Both values are collection-wide constants, so a fill-insert
+	// per target vector replaces the per-element push_back pair
+	lBndVec.insert(lBndVec.end(), this->size(), this->getLowerInitBoundary());
+	uBndVec.insert(uBndVec.end(), this->size(), this->getUpperInitBoundary());
 }
 
 /******************************************************************************/
@@ -196,21 +193,21 @@ std::size_t GInt32Collection::countInt32Parameters(
 void GInt32Collection::assignInt32ValueVector(
 	const std::vector<std::int32_t> &parVec, std::size_t &pos, const activityMode &am
 ) {
-	for (GInt32Collection::iterator it = this->begin(); it != this->end(); ++it) {
 #ifdef DEBUG
-		// Do we have a valid position ?
-		if(pos >= parVec.size()) {
-			throw gemfony_exception(
-				g_error_streamer(DO_LOG,  time_and_place)
-					<< "In GInt32Collection::assignInt32ValueVector(const std::vector<std::int32_t>&, std::size_t&):" << std::endl
-					<< "Tried to access position beyond end of vector: " << parVec.size() << "/" << pos << std::endl
-			);
-		}
+	// Do we have enough values left in the vector ?
+	if(pos + this->size() > parVec.size()) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GInt32Collection::assignInt32ValueVector(const std::vector<std::int32_t>&, std::size_t&):" << std::endl
+				<< "Tried to access position beyond end of vector: " << parVec.size() << "/" << pos + this->size() << std::endl
+		);
+	}
 #endif
 
-		(*it) = parVec[pos];
-		pos++;
-	}
+	// The range check above covers the whole assignment, so the values may
+	// be copied in one sweep
+	std::copy_n(parVec.begin() + pos, this->size(), this->begin());
+	pos += this->size();
 }
 
 /******************************************************************************/
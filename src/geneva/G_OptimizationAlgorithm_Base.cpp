@@ -1533,7 +1533,32 @@ std::vector<std::shared_ptr<GParameterSet>> G_OptimizationAlgorithm_Base::getOld
  * Saves the state of the class to disc
  */
 void G_OptimizationAlgorithm_Base::saveCheckpoint(bf::path const& outputFile) const {
-	this->toFile(outputFile, this->getCheckpointSerializationMode());
+	// Serialization must happen synchronously, so the checkpoint reflects the
+	// population as it looks right now. The file I/O, however, is handed to a
+	// single background thread, so the optimization cycle does not stall on the
+	// disc. A single writer thread processes requests in submission order, so
+	// later checkpoints cannot overtake earlier ones. The pool's destructor
+	// waits for outstanding writes, hence no checkpoint is lost at shutdown.
+	std::string checkpointData = this->toString(this->getCheckpointSerializationMode());
+
+	static Gem::Common::GThreadPool checkpointWriter(1);
+	checkpointWriter.async_schedule(
+		[outputFile, data = std::move(checkpointData)]() {
+			bf::ofstream ofstr(outputFile, std::ofstream::trunc); // Note: will overwrite existing files
+
+			if(not ofstr) {
+				glogger
+					<< "In G_OptimizationAlgorithm_Base::saveCheckpoint(): Warning!" << std::endl
+					<< "Problems connecting to file " << outputFile.string() << std::endl
+					<< "The checkpoint will not be written" << std::endl
+					<< GWARNING;
+				return;
+			}
+
+			ofstr << data;
+			ofstr.close();
+		}
+	);
 }
 
 /******************************************************************************/
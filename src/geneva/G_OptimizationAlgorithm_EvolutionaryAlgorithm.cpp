@@ -804,6 +804,66 @@ std::shared_ptr<GPersonalityTraits> GEvolutionaryAlgorithm::getPersonalityTraits
 	return std::shared_ptr<GEvolutionaryAlgorithm_PersonalityTraits>(new GEvolutionaryAlgorithm_PersonalityTraits());
 }
 
+/******************************************************************************/
+/**
+ * Partially sorts the range [first, data.size()) of the population such that the
+ * [first, middle) sub-range contains the best individuals, ordered by their
+ * minimization-view fitness. The fitness of every individual in the range is
+ * read exactly once into a flat key buffer, the sort then compares only those
+ * keys, and the pointer array is rearranged in a single pass at the end. The
+ * direct alternative -- handing a fitness-comparing lambda to std::partial_sort
+ * -- re-evaluates minOnly_transformed_fitness() and dereferences two
+ * individuals for every comparison, which makes the sort latency- rather than
+ * bandwidth-bound. The buffers are local to this call, as they are pure
+ * scratch space which would otherwise have to be excluded from serialization
+ * and comparison by hand.
+ *
+ * @param first The beginning of the range to be sorted
+ * @param middle The end of the sub-range that must end up sorted
+ */
+void GEvolutionaryAlgorithm::sortRangeOnCachedFitness(
+	std::size_t first
+	, std::size_t middle
+) {
+	auto& data_cnt = G_OptimizationAlgorithm_Base::m_data_cnt;
+	const std::size_t dataSize = data_cnt.size();
+
+	// Cache each individual's fitness exactly once, next to its position
+	std::vector<double> fitnessCache(dataSize);
+	std::vector<std::size_t> sortIndex(dataSize);
+	for(std::size_t pos = first; pos < dataSize; pos++) {
+#if defined(__GNUC__)
+		// The fitness read below chases pointer -> individual -> fitness
+		// member, a dependent load chain the core cannot overlap on its own.
+		// Requesting the individual a few iterations ahead hides part of the
+		// memory latency for populations that exceed the cache.
+		if(pos + 8 < dataSize) {
+			__builtin_prefetch(data_cnt[pos + 8].get(), 0, 1);
+		}
+#endif /* __GNUC__ */
+		fitnessCache[pos] = minOnly_transformed_fitness(data_cnt[pos]);
+		sortIndex[pos] = pos;
+	}
+
+	// Sort the indices on the flat key buffer
+	std::partial_sort(
+		sortIndex.begin() + first
+		, sortIndex.begin() + middle
+		, sortIndex.end()
+		, [&fitnessCache](std::size_t x, std::size_t y) -> bool {
+			return fitnessCache[x] < fitnessCache[y];
+		}
+	);
+
+	// Rearrange the individuals in a single pass
+	std::vector<std::shared_ptr<GParameterSet>> scratch;
+	scratch.reserve(dataSize - first);
+	for(std::size_t pos = first; pos < dataSize; pos++) {
+		scratch.push_back(std::move(data_cnt[sortIndex[pos]]));
+	}
+	std::move(scratch.begin(), scratch.end(), data_cnt.begin() + first);
+}
+
 /******************************************************************************/
 /**
  * Selection, MUPLUSNU_SINGLEEVAL style. Note that not all individuals of the population (including parents)
@@ -827,15 +887,8 @@ void GEvolutionaryAlgorithm::sortMuPlusNuMode() {
 	}
 #endif /* DEBUG */
 
-	// Only partially sort the arrays
-	std::partial_sort(
-		G_OptimizationAlgorithm_Base::m_data_cnt.begin()
-		, G_OptimizationAlgorithm_Base::m_data_cnt.begin() + m_n_parents
-		, G_OptimizationAlgorithm_Base::m_data_cnt.end()
-		, [](std::shared_ptr<GParameterSet> x_ptr, std::shared_ptr<GParameterSet> y_ptr) -> bool {
-			return minOnly_transformed_fitness(x_ptr) < minOnly_transformed_fitness(y_ptr);
-		}
-	);
+	// Only partially sort the arrays, comparing cached fitness keys
+	this->sortRangeOnCachedFitness(0, m_n_parents);
 }
 
 /******************************************************************************/
@@ -881,15 +934,8 @@ void GEvolutionaryAlgorithm::sortMuCommaNuMode() {
 	}
 #endif /* DEBUG */
 
-	// Only sort the children
-	std::partial_sort(
-		G_OptimizationAlgorithm_Base::m_data_cnt.begin() + m_n_parents
-		, G_OptimizationAlgorithm_Base::m_data_cnt.begin() + 2 * m_n_parents
-		, G_OptimizationAlgorithm_Base::m_data_cnt.end()
-		, [](std::shared_ptr<GParameterSet> x_ptr, std::shared_ptr<GParameterSet> y_ptr) -> bool {
-			return minOnly_transformed_fitness(x_ptr) < minOnly_transformed_fitness(y_ptr);
-		}
-	);
+	// Only sort the children, comparing cached fitness keys
+	this->sortRangeOnCachedFitness(m_n_parents, 2 * m_n_parents);
 
 	std::swap_ranges(
 		G_OptimizationAlgorithm_Base::m_data_cnt.begin()
@@ -924,15 +970,8 @@ void GEvolutionaryAlgorithm::sortMunu1pretainMode() {
 	}
 #endif /* DEBUG */
 
-	// Sort the children
-	std::partial_sort(
-		G_OptimizationAlgorithm_Base::m_data_cnt.begin() + m_n_parents
-		, G_OptimizationAlgorithm_Base::m_data_cnt.begin() + 2*m_n_parents
-		, G_OptimizationAlgorithm_Base::m_data_cnt.end()
-		, [](std::shared_ptr<GParameterSet> x_ptr, std::shared_ptr<GParameterSet> y_ptr) -> bool {
-			return minOnly_transformed_fitness(x_ptr) < minOnly_transformed_fitness(y_ptr);
-		}
-	);
+	// Sort the children, comparing cached fitness keys
+	this->sortRangeOnCachedFitness(m_n_parents, 2*m_n_parents);
 
 	// Retrieve the best child's and the last generation's best parent's fitness
 	double bestTranformedChildFitness_MinOnly  = minOnly_transformed_fitness(
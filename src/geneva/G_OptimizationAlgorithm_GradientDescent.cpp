@@ -157,6 +157,38 @@ double GGradientDescent::getStepSize() const {
 	return stepSize_;
 }
 
+/******************************************************************************/
+/**
+ * Sets the weight given to the preceding step of each parent. A value of 0
+ * results in plain steepest descent, values closer to 1 carry an ever larger
+ * fraction of the last step over into the current iteration.
+ *
+ * @param momentum The desired weight of the preceding step
+ */
+void GGradientDescent::setMomentum(double momentum) {
+	// Check that the momentum term has an appropriate value
+	if (momentum < 0. || momentum >= 1.) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GGradientDescent::setMomentum(double): Error!" << std::endl
+				<< "Invalid value of momentum: " << momentum << std::endl
+				<< "Must be in the range [0.:1.[" << std::endl
+		);
+	}
+
+	momentum_ = momentum;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the weight given to the preceding step of each parent
+ *
+ * @return The current value of the momentum term
+ */
+double GGradientDescent::getMomentum() const {
+	return momentum_;
+}
+
 /******************************************************************************/
 /**
  * Retrieve the number of processable items in the current iteration.
@@ -215,10 +247,12 @@ void GGradientDescent::compare_(
 	compare_t(IDENTITY(nFPParmsFirst_, p_load->nFPParmsFirst_), token);
 	compare_t(IDENTITY(finiteStep_, p_load->finiteStep_), token);
 	compare_t(IDENTITY(stepSize_, p_load->stepSize_), token);
+	compare_t(IDENTITY(momentum_, p_load->momentum_), token);
 	compare_t(IDENTITY(stepRatio_, p_load->stepRatio_), token);
 	compare_t(IDENTITY(dblLowerParameterBoundaries_, p_load->dblLowerParameterBoundaries_), token);
 	compare_t(IDENTITY(dblUpperParameterBoundaries_, p_load->dblUpperParameterBoundaries_), token);
 	compare_t(IDENTITY(adjustedFiniteStep_, p_load->adjustedFiniteStep_), token);
+	compare_t(IDENTITY(prevStep_, p_load->prevStep_), token);
 
 	// React on deviations from the expectation
 	token.evaluate();
@@ -234,6 +268,7 @@ void GGradientDescent::resetToOptimizationStart_() {
 	dblLowerParameterBoundaries_.clear(); // Holds lower boundaries of double parameters; Will be extracted in init()
 	dblUpperParameterBoundaries_.clear(); // Holds upper boundaries of double parameters; Will be extracted in init()
 	adjustedFiniteStep_.clear(); // A step-size normalized to each parameter range; Will be recalculated in init()
+	prevStep_.clear(); // The step last taken in each direction of each parent; Will be resized in init()
 
 	// There is no more work to be done here, so we simply call the
 	// function of the parent class
@@ -267,7 +302,9 @@ void GGradientDescent::load_(const GObject *cp) {
 	nFPParmsFirst_ = p_load->nFPParmsFirst_;
 	finiteStep_ = p_load->finiteStep_;
 	stepSize_ = p_load->stepSize_;
+	momentum_ = p_load->momentum_;
 	// stepRatio_ = p_load->stepRatio_; // temporary parameter
+	// prevStep_ = p_load->prevStep_; // temporary parameter
 	// m_dbl_lower_parameter_boundaries_cnt = p_load->m_dbl_lower_parameter_boundaries_cnt; // temporary parameter
 	// m_dbl_upper_parameter_boundaries_cnt = p_load->m_dbl_upper_parameter_boundaries_cnt; // temporary parameter
 	// adjustedFiniteStep_ = p_load->adjustedFiniteStep_; // temporary parameter
@@ -391,13 +428,17 @@ void GGradientDescent::updateParentIndividuals() {
 			std::size_t childPos = nStartingPoints_ + i * nFPParmsFirst_ + j;
 
 			// Calculate the step to be performed in a given direction and
-			// adjust the parameter vector of each parent
+			// adjust the parameter vector of each parent. A non-zero momentum
+			// term carries part of the preceding step over into this iteration.
 			try {
-				parmVec[j] -= boost::numeric_cast<double>(
+				double step = boost::numeric_cast<double>(
 					stepRatio_ *
 					(boost::numeric_cast<long double>(
 						minOnly_transformed_fitness(this->at(childPos)) - boost::numeric_cast<long double>(parentFitness)))
 				);
+				step += momentum_ * prevStep_[i * nFPParmsFirst_ + j];
+				prevStep_[i * nFPParmsFirst_ + j] = step;
+				parmVec[j] -= step;
 			} catch (boost::bad_numeric_cast &e) {
 				throw gemfony_exception(
 					g_error_streamer(DO_LOG,  time_and_place)
@@ -450,6 +491,14 @@ void GGradientDescent::addConfigurationOptions_(
 		<< "direction of steepest descent," << std::endl
 		<< "specified in per mill of the allowed or expected value" << std::endl
 		<< "range of a parameter";
+
+	gpb.registerFileParameter<double>(
+		"momentum" // The name of the variable
+		, DEFAULTGDMOMENTUM // The default value
+		, [this](double mn) { this->setMomentum(mn); }
+	)
+		<< "The weight given to the preceding step of each parent," << std::endl
+		<< "in the range [0:1[. 0 results in plain steepest descent";
 }
 
 /******************************************************************************/
@@ -552,6 +601,7 @@ void GGradientDescent::init() {
 	// Calculate a specific finiteStep_ value for each parameter in long double precision
 	try {
 		adjustedFiniteStep_.clear();
+		adjustedFiniteStep_.reserve(dblLowerParameterBoundaries_.size()); // One entry per parameter -- avoids reallocations below
 		long double finiteStepRatio = ((long double) finiteStep_) / ((long double) 1000.);
 		for (std::size_t pos = 0; pos < dblLowerParameterBoundaries_.size(); pos++) {
 			long double parameterRange =
@@ -566,6 +616,10 @@ void GGradientDescent::init() {
 		);
 	}
 
+	// Start with a clean slate for the momentum term -- one entry
+	// per direction of each starting point
+	prevStep_.assign(nStartingPoints_ * dblLowerParameterBoundaries_.size(), 0.);
+
 	// Tell individuals about their position in the population
 	markIndividualPositions();
 }
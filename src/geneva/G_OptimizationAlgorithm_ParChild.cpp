@@ -135,23 +135,6 @@ std::size_t G_OptimizationAlgorithm_ParChild::getNParents() const {
 	return (std::min)(this->size(), m_n_parents);
 }
 
-/******************************************************************************/
-/**
- * Calculates the current number of children from the number of parents and the
- * size of the vector.
- *
- * @return The number of children in the population
- */
-std::size_t G_OptimizationAlgorithm_ParChild::getNChildren() const {
-	if(this->size() <= m_n_parents) {
-		// This will happen, when only the default population size has been set,
-		// but no individuals have been added yet
-		return 0;
-	} else {
-		return this->size() - m_n_parents;
-	}
-}
-
 /******************************************************************************/
 /**
  * Retrieves the defaultNChildren_ parameter. E.g. in GTransferPopulation::adaptChildren() ,
@@ -350,6 +333,18 @@ void G_OptimizationAlgorithm_ParChild::doRecombine() {
 		threshold[m_n_parents - 1] = 1.; // Necessary due to rounding errors
 	}
 
+	// Resolve the duplication scheme once, outside of the child loop. Value-based
+	// recombination requires more than one parent and makes no sense in the first
+	// iteration, as parents might not have a suitable value yet -- using it there
+	// might accidentally trigger value calculation. In all other situations we
+	// fall back to random recombination, which covers the single-parent case by
+	// always selecting parent 0. This keeps the per-child body free of dispatch
+	// beyond the amalgamation coin flip.
+	const bool useValueRecombination =
+		duplicationScheme::VALUEDUPLICATIONSCHEME == m_recombination_method
+		&& m_n_parents > 1
+		&& not G_OptimizationAlgorithm_Base::inFirstIteration();
+
 	std::vector<std::shared_ptr<GParameterSet>>::iterator it;
 	std::bernoulli_distribution amalgamationWanted(m_amalgamationLikelihood); // true with a likelihood of m_amalgamation_likelihood
 	for (it = G_OptimizationAlgorithm_Base::m_data_cnt.begin() + m_n_parents;
@@ -361,33 +356,10 @@ void G_OptimizationAlgorithm_ParChild::doRecombine() {
 			std::shared_ptr <GParameterSet> combiner = (m_n_parents > 2) ? (*(this->begin() + this->m_uniform_int_distribution(this->m_gr, std::uniform_int_distribution<std::size_t>::param_type(1, m_n_parents - 1)))) : (*(this->begin() + 1));
 
 			(*it)->GObject::load(bestParent->crossOverWith(combiner));
-		} else { // Just perform duplication
-			switch (m_recombination_method) {
-				case duplicationScheme::DEFAULTDUPLICATIONSCHEME: // we want the RANDOMDUPLICATIONSCHEME behavior
-				case duplicationScheme::RANDOMDUPLICATIONSCHEME: {
-					randomRecombine(*it);
-				}
-					break;
-
-				case duplicationScheme::VALUEDUPLICATIONSCHEME: {
-					if (m_n_parents == 1) {
-						(*it)->GObject::load(*(G_OptimizationAlgorithm_Base::m_data_cnt.begin()));
-						(*it)->GParameterSet::getPersonalityTraits<GBaseParChildPersonalityTraits> ()->setParentId(0);
-					} else {
-						// A recombination taking into account the value does not make
-						// sense in the first iteration, as parents might not have a suitable
-						// value. Instead, this function might accidentaly trigger value
-						// calculation. Hence we fall back to random recombination in iteration 0.
-						// No value calculation takes place there.
-						if (G_OptimizationAlgorithm_Base::inFirstIteration()) {
-							randomRecombine(*it);
-						} else {
-							valueRecombine(*it, threshold);
-						}
-					}
-				}
-					break;
-			}
+		} else if (useValueRecombination) {
+			valueRecombine(*it, threshold);
+		} else { // Just perform random duplication
+			randomRecombine(*it);
 		}
 	}
 }
@@ -466,11 +438,9 @@ void G_OptimizationAlgorithm_ParChild::recombine() {
 	// Do the actual recombination
 	doRecombine();
 
-	// Let children know they are children
-	markChildren();
-
-	// Tell individuals about their ids
-	markIndividualPositions();
+	// Let children know they are children and tell all individuals about
+	// their ids, in a single pass over the population
+	markChildrenAndPositions();
 }
 
 /******************************************************************************/
@@ -518,6 +488,26 @@ void G_OptimizationAlgorithm_ParChild::markIndividualPositions() {
 	}
 }
 
+/******************************************************************************/
+/**
+ * This helper function marks children as children and lets all individuals
+ * know about their position in the population, in a single pass. Compared
+ * to calling markChildren() and markIndividualPositions() back to back this
+ * performs the personality-traits conversion only once per individual and
+ * walks the population only once.
+ */
+void G_OptimizationAlgorithm_ParChild::markChildrenAndPositions() {
+	std::size_t pos = 0;
+	typename std::vector<std::shared_ptr<GParameterSet>>::iterator it;
+	for(it=G_OptimizationAlgorithm_Base::m_data_cnt.begin(); it!=G_OptimizationAlgorithm_Base::m_data_cnt.end(); ++it) {
+		auto pt_ptr = (*it)->GParameterSet::template getPersonalityTraits<GBaseParChildPersonalityTraits>();
+		if(pos >= m_n_parents) {
+			pt_ptr->setIsChild();
+		}
+		pt_ptr->setPopulationPosition(pos++);
+	}
+}
+
 /******************************************************************************/
 /**
  * This function implements the logic that constitutes evolutionary algorithms. The
@@ -710,29 +700,29 @@ void G_OptimizationAlgorithm_ParChild::valueRecombine(
 	std::shared_ptr<GParameterSet>& p
 	, const std::vector<double>& threshold
 ) {
-	bool done=false;
 	double randTest // get the test value
 		= G_OptimizationAlgorithm_Base::m_uniform_real_distribution(this->m_gr);
 
-	for(std::size_t par=0; par<m_n_parents; par++) {
-		if(randTest<threshold[par]) {
-			// Load the parent's data
-			p->GObject::load(*(G_OptimizationAlgorithm_Base::m_data_cnt.begin() + par));
-			// Let the individual know the parent's id
-			p->GParameterSet::template getPersonalityTraits<GBaseParChildPersonalityTraits>()->setParentId(par);
-			done = true;
-
-			break;
-		}
-	}
+	// The threshold vector holds a cumulative distribution over the parents,
+	// computed once per generation in doRecombine(). A binary search for the
+	// first entry above the test value hence replaces the former linear scan.
+	auto thresholdEnd = threshold.begin() + m_n_parents;
+	auto pos_it = std::upper_bound(threshold.begin(), thresholdEnd, randTest);
 
-	if(not done) {
+	if(pos_it == thresholdEnd) {
 		throw gemfony_exception(
 			g_error_streamer(DO_LOG,  time_and_place)
 				<< "In G_OptimizationAlgorithm_ParChild::valueRecombine():" << std::endl
 				<< "Could not recombine." << std::endl
 		);
 	}
+
+	std::size_t par = static_cast<std::size_t>(std::distance(threshold.begin(), pos_it));
+
+	// Load the parent's data
+	p->GObject::load(*(G_OptimizationAlgorithm_Base::m_data_cnt.begin() + par));
+	// Let the individual know the parent's id
+	p->GParameterSet::template getPersonalityTraits<GBaseParChildPersonalityTraits>()->setParentId(par);
 }
 
 /******************************************************************************/
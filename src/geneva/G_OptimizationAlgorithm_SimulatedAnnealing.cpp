@@ -656,13 +656,16 @@ void GSimulatedAnnealing::sortSAMode() {
 
 	// Check for each parent whether it should be replaced by the corresponding child
 	for (std::size_t np = 0; np < this->m_n_parents; np++) {
-		double pPass = saProb(
-			minOnly_transformed_fitness(this->at(np))
-			, minOnly_transformed_fitness(this->at(this->m_n_parents + np))
-		);
-		if (pPass >= 1.) {
+		double fParent = minOnly_transformed_fitness(this->at(np));
+		double fChild  = minOnly_transformed_fitness(this->at(this->m_n_parents + np));
+
+		// A child that is at least as good as its parent always passes. Checking
+		// the fitness values directly avoids the exp()-call inside of saProb()
+		// for this case -- saProb() would return a value >= 1 for it anyway.
+		if (fChild <= fParent) {
 			this->at(np)->GObject::load(this->at(this->m_n_parents + np));
 		} else {
+			double pPass = saProb(fParent, fChild);
 			double challenge =
 				this->m_uniform_real_distribution(this->m_gr, std::uniform_real_distribution<double>::param_type(0.,1.));
 			if (challenge < pPass) {
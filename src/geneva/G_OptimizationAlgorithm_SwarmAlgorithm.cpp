@@ -633,6 +633,12 @@ void GSwarmAlgorithm::init() {
 	// Make sure the m_velocities_cnt vector is really empty
 	m_velocities_cnt.clear();
 
+	// Reserve the full population size up-front. Both vectors are refilled in
+	// every iteration with a population of constant size, so reserving once
+	// here avoids repeated allocator round-trips in the hot outer loop.
+	m_velocities_cnt.reserve(this->getDefaultPopulationSize());
+	m_last_iteration_individuals_cnt.reserve(this->getDefaultPopulationSize());
+
 	// Create copies of our individuals in the m_velocities_cnt vector.
 	std::size_t pos = 0;
 	for(const auto& ind_ptr: *this) {
@@ -701,8 +707,10 @@ void GSwarmAlgorithm::init() {
  */
 void GSwarmAlgorithm::finalize() {
 	// Remove remaining velocity individuals. The std::shared_ptr<GParameterSet>s
-	// will take care of deleting the GParameterSet objects.
-	m_velocities_cnt.clear();
+	// will take care of deleting the GParameterSet objects. Swapping with empty
+	// vectors also returns the capacity reserved in init() to the allocator.
+	std::vector<std::shared_ptr<GParameterSet>>().swap(m_velocities_cnt);
+	std::vector<std::shared_ptr<GParameterSet>>().swap(m_last_iteration_individuals_cnt);
 
 	// Last action
 	G_OptimizationAlgorithm_Base::finalize();
@@ -737,6 +745,15 @@ void GSwarmAlgorithm::actOnStalls_() {
 std::tuple<double, double> GSwarmAlgorithm::cycleLogic_() {
 	std::tuple<double, double> bestIndividualFitness;
 
+	// NOTE: It has been considered to overlap the broker round-trip inside of
+	// runFitnessCalculation_() with the next iteration's position updates, so
+	// that network latency hides behind the CPU work. This is not possible with
+	// the classic swarm update, however: each position update depends on the
+	// personal, neighborhood and global bests determined by findBests() from
+	// the evaluations of the very same iteration, and the executor's workOn()
+	// interface is synchronous. Revisit if an asynchronous submission interface
+	// is ever added to the courtier layer.
+
 	// First update the positions and neighborhood ids
 	updatePositions();
 
@@ -806,11 +823,14 @@ void GSwarmAlgorithm::adjustNeighborhoods() {
 			std::size_t nMissing = m_default_n_neighborhood_members - m_n_neighborhood_members_cnt[n];
 
 			if (afterFirstIteration()) { // The most likely case
-				// Copy the best items of this neighborhood over from the m_last_iteration_individuals_cnt vector.
+				// Move the best items of this neighborhood over from the m_last_iteration_individuals_cnt vector.
 				// Each neighborhood there should have been sorted according to the individuals
-				// fitness, with the best individuals in the front of each neighborhood.
+				// fitness, with the best individuals in the front of each neighborhood. As
+				// m_last_iteration_individuals_cnt is discarded at the end of this function,
+				// we may move the smart pointers out instead of copying them, thus avoiding
+				// needless reference count updates.
 				for (std::size_t i = 0; i < nMissing; i++) {
-					m_data_cnt.insert(m_data_cnt.begin() + firstNIPos, *(m_last_iteration_individuals_cnt.begin() + firstNIPos + i));
+					m_data_cnt.insert(m_data_cnt.begin() + firstNIPos, std::move(*(m_last_iteration_individuals_cnt.begin() + firstNIPos + i)));
 				}
 			} else { // first iteration
 #ifdef DEBUG
@@ -927,7 +947,16 @@ void GSwarmAlgorithm::updatePositions() {
 	}
 #endif /* DEBUG */
 
+	// Extract the globally best individual's parameters once per iteration. Individual
+	// position updates only read these values, so there is no need to stream them out
+	// of the parameter tree again for every single particle.
+	std::vector<double> glbBestVec;
+	if (afterFirstIteration() && m_global_best_ptr) {
+		m_global_best_ptr->streamline(glbBestVec, activityMode::ACTIVEONLY);
+	}
+
 	// First update all positions
+	std::vector<double> nbhBestVec;
 	for (std::size_t n = 0; n < m_n_neighborhoods; n++) {
 #ifdef DEBUG
 		if(afterFirstIteration()) {
@@ -958,6 +987,13 @@ void GSwarmAlgorithm::updatePositions() {
 		}
 #endif /* DEBUG */
 
+		// Likewise extract the neighborhood best's parameters only once per neighborhood,
+		// rather than once per member
+		if (afterFirstIteration()) {
+			nbhBestVec.clear();
+			m_neighborhood_bests_cnt[n]->streamline(nbhBestVec, activityMode::ACTIVEONLY);
+		}
+
 		for (std::size_t member = 0; member < m_n_neighborhood_members_cnt[n]; member++) {
 			auto current = start + neighborhood_offset;
 
@@ -969,7 +1005,7 @@ void GSwarmAlgorithm::updatePositions() {
 				 not (*current)->getPersonalityTraits<GSwarmAlgorithm_PersonalityTraits>()->checkNoPositionUpdateAndReset()) {
 				// Update the swarm positions:
 				updateIndividualPositions(
-					n, (*current), m_neighborhood_bests_cnt[n], m_global_best_ptr, m_velocities_cnt[neighborhood_offset], std::make_tuple(
+					n, (*current), nbhBestVec, glbBestVec, m_velocities_cnt[neighborhood_offset], std::make_tuple(
 						getCPersonal(), getCNeighborhood(), getCGlobal(), getCVelocity()
 					)
 				);
@@ -987,16 +1023,16 @@ void GSwarmAlgorithm::updatePositions() {
  *
  * @param neighborhood The neighborhood that has been assigned to the individual
  * @param ind The individual whose position should be updated
- * @param neighborhood_best_tmp The best data set of the individual's neighborhood
- * @param global_best_tmp The globally best individual so far
+ * @param nbhBestParams The parameters of the best data set of the individual's neighborhood
+ * @param glbBestParams The parameters of the globally best individual so far
  * @param velocity A velocity vector
  * @param constants A std::tuple holding the various constants needed for the position update
  */
 void GSwarmAlgorithm::updateIndividualPositions(
 	const std::size_t &neighborhood
 	, std::shared_ptr <GParameterSet> ind
-	, std::shared_ptr <GParameterSet> neighborhood_best
-	, std::shared_ptr <GParameterSet> global_best
+	, const std::vector<double>& nbhBestParams
+	, const std::vector<double>& glbBestParams
 	, std::shared_ptr <GParameterSet> velocity
 	, std::tuple<double, double, double, double> constants
 ) {
@@ -1030,19 +1066,19 @@ void GSwarmAlgorithm::updateIndividualPositions(
 		);
 	}
 
-	if(not neighborhood_best) {
+	if(nbhBestParams.empty()) {
 		throw gemfony_exception(
 			g_error_streamer(DO_LOG,  time_and_place)
 				<< "In GSwarmAlgorithm::updateIndividualPositions():" << std::endl
-				<< "Found empty individual \"neighborhood_best\"" << std::endl
+				<< "Found empty parameter vector \"nbhBestParams\"" << std::endl
 		);
 	}
 
-	if(not global_best) {
+	if(glbBestParams.empty()) {
 		throw gemfony_exception(
 			g_error_streamer(DO_LOG,  time_and_place)
 				<< "In GSwarmAlgorithm::updateIndividualPositions():" << std::endl
-				<< "Found empty individual \"global_best\"" << std::endl
+				<< "Found empty parameter vector \"glbBestParams\"" << std::endl
 		);
 	}
 
@@ -1056,14 +1092,15 @@ void GSwarmAlgorithm::updateIndividualPositions(
 
 #endif /* DEBUG */
 
-	// Extract the vectors for the individual, the personal, neighborhood and global bests,
-	// as well as the velocity
-	std::vector<double> indVec, personalBestVec, nbhBestVec, glbBestVec, velVec;
+	// Extract the vectors for the individual, the personal best and the velocity.
+	// The neighborhood and global bests were already streamlined by the caller
+	// (once per neighborhood resp. iteration) -- we only need local working copies.
+	std::vector<double> indVec, personalBestVec, velVec;
 	ind->streamline(indVec, activityMode::ACTIVEONLY);
 	personal_best->streamline(personalBestVec, activityMode::ACTIVEONLY);
-	neighborhood_best->streamline(nbhBestVec, activityMode::ACTIVEONLY);
-	global_best->streamline(glbBestVec, activityMode::ACTIVEONLY);
 	velocity->streamline(velVec, activityMode::ACTIVEONLY);
+	std::vector<double> nbhBestVec(nbhBestParams);
+	std::vector<double> glbBestVec(glbBestParams);
 
 	// Subtract the individual vector from the personal, neighborhood and global bests
 	Gem::Common::subtractVec<double>(personalBestVec, indVec);
@@ -1200,10 +1237,12 @@ void GSwarmAlgorithm::runFitnessCalculation_() {
 	auto old_work_items = this->getOldWorkItems();
 
 	// Update the iteration of older individuals (they will keep their old neighborhood id)
-	// and attach them to the data vector
-	for(const auto& item_ptr: old_work_items) {
+	// and attach them to the data vector. The smart pointers are moved rather than copied,
+	// as old_work_items is discarded right after this loop -- no need to pay for
+	// atomic reference count updates on this hot path.
+	for(auto& item_ptr: old_work_items) {
 		item_ptr->setAssignedIteration(this->getIteration());
-		this->push_back(item_ptr);
+		this->push_back(std::move(item_ptr));
 	}
 	old_work_items.clear();
 
@@ -1254,9 +1293,16 @@ void GSwarmAlgorithm::runFitnessCalculation_() {
 
 	// Now update the number of items in each neighborhood: First reset the number of members of each neighborhood
 	Gem::Common::assignVecConst(m_n_neighborhood_members_cnt, (std::size_t)0);
-	// Then update the number of individuals in each neighborhood
-	for(const auto& item_ptr: *this) {
-		m_n_neighborhood_members_cnt[item_ptr->getPersonalityTraits<GSwarmAlgorithm_PersonalityTraits>()->getNeighborhood()] += 1;
+	// Then update the number of individuals in each neighborhood. The individuals
+	// were just received back from the broker and are unlikely to be cache-resident,
+	// so we ask for the one after the next while the current one is being processed.
+	for(std::size_t i = 0; i < m_data_cnt.size(); i++) {
+#if defined(__GNUC__)
+		if(i + 2 < m_data_cnt.size()) {
+			__builtin_prefetch(m_data_cnt[i + 2].get(), 0, 0);
+		}
+#endif
+		m_n_neighborhood_members_cnt[m_data_cnt[i]->getPersonalityTraits<GSwarmAlgorithm_PersonalityTraits>()->getNeighborhood()] += 1;
 	}
 
 	// The population will be fixed in the GSwarmAlgorithm::adjustNeighborhoods() function
@@ -1306,7 +1352,11 @@ std::tuple<double, double> GSwarmAlgorithm::findBests() {
 		}
 	}
 
-	// Sort individuals in all neighborhoods according to their fitness
+	// Sort individuals in all neighborhoods according to their fitness. All further
+	// reductions -- the update of the neighborhood bests, the search for the best
+	// neighborhood and the best fitness of this iteration -- only depend on the
+	// front element of each sorted neighborhood, so they are fused into this single
+	// pass instead of re-scanning the population afterwards.
 	for (std::size_t n = 0; n < m_n_neighborhoods; n++) {
 		// identify the first and last id of the individuals in the current neighborhood
 		std::size_t firstCounter = getFirstNIPos(n);
@@ -1320,6 +1370,16 @@ std::tuple<double, double> GSwarmAlgorithm::findBests() {
 			}
 		);
 
+		// Every individual belongs to exactly one neighborhood, so the best fitness
+		// of this iteration is the best among the neighborhoods' front elements
+		if(isBetter(
+			std::get<G_TRANSFORMED_FITNESS>((*(this->begin() + firstCounter))->getFitnessTuple())
+			, std::get<G_TRANSFORMED_FITNESS>(bestIterationFitness)
+			, m
+		)) {
+			bestIterationFitness = (*(this->begin() + firstCounter))->getFitnessTuple();
+		}
+
 		// Check whether the best individual of the neighborhood is better than
 		// the best individual found so far in this neighborhood
 		if (inFirstIteration()) {
@@ -1334,10 +1394,8 @@ std::tuple<double, double> GSwarmAlgorithm::findBests() {
 				(m_neighborhood_bests_cnt.at(n))->GObject::load(*(this->begin() + firstCounter));
 			}
 		}
-	}
 
-	// Identify the best individuals among all neighborhood bests
-	for (std::size_t n = 0; n < m_n_neighborhoods; n++) {
+		// Keep track of the best individual among all neighborhood bests
 		if(isBetter(
 			(m_neighborhood_bests_cnt.at(n))->transformed_fitness(0)
 			, std::get<G_TRANSFORMED_FITNESS>(bestLocalFitness)
@@ -1362,17 +1420,8 @@ std::tuple<double, double> GSwarmAlgorithm::findBests() {
 		}
 	}
 
-	// Identify the best fitness in the current iteration
-	for (std::size_t i = 0; i < this->size(); i++) {
-		if(isBetter(
-			std::get<G_TRANSFORMED_FITNESS>(this->at(i)->getFitnessTuple())
-			, std::get<G_TRANSFORMED_FITNESS>(bestIterationFitness)
-			, m
-		)) {
-			bestIterationFitness = this->at(i)->getFitnessTuple();
-		}
-	}
-
+	// The best fitness of the current iteration was already determined in the
+	// sorting pass over the neighborhoods above
 	return bestIterationFitness;
 }
 
@@ -54,18 +54,6 @@ GRandomBase::GRandomBase()
 GRandomBase::~GRandomBase()
 { /* nothing */ }
 
-/******************************************************************************/
-/**
- * Retrieves a raw random item. This function, together with the min() and
- * max() functions make it possible to use GRandomBase as a generator for
- * boost's random distributions.
- *
- * @return A "raw" random number suitable for a C++11 standard random engine
- */
-GRandomBase::result_type GRandomBase::operator()() {
-	return this->int_random();
-}
-
 /******************************************************************************/
 
 } /* namespace Hap */
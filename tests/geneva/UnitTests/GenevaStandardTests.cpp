@@ -146,26 +146,44 @@ public:
 
 		/*****************************************************************************************/
 
-		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, adaptor_types ) );
-		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, adaptor_types ) );
-
-		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, data_types ) );
-		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, data_types ) );
-
-		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, object_collection_types ) );
-		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, object_collection_types ) );
-
-		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, pod_collection_types ) );
-		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, pod_collection_types ) );
-
+		// The test cases are registered in named child suites, one per group of
+		// types. The groups are independent of each other, so the accompanying
+		// CMakeLists.txt registers each of them as its own CTest entry (via
+		// --run_test=GenevaStandardTestSuite/<group>), allowing "ctest -j<N>"
+		// to run the groups in parallel processes.
+		test_suite *adaptor_tests = BOOST_TEST_SUITE( "AdaptorTests" );
+		adaptor_tests->add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, adaptor_types ) );
+		adaptor_tests->add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, adaptor_types ) );
+		add( adaptor_tests );
+
+		test_suite *data_type_tests = BOOST_TEST_SUITE( "DataTypeTests" );
+		data_type_tests->add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, data_types ) );
+		data_type_tests->add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, data_types ) );
+		add( data_type_tests );
+
+		test_suite *object_collection_tests = BOOST_TEST_SUITE( "ObjectCollectionTests" );
+		object_collection_tests->add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, object_collection_types ) );
+		object_collection_tests->add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, object_collection_types ) );
+		add( object_collection_tests );
+
+		test_suite *pod_collection_tests = BOOST_TEST_SUITE( "PodCollectionTests" );
+		pod_collection_tests->add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, pod_collection_types ) );
+		pod_collection_tests->add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, pod_collection_types ) );
+		add( pod_collection_tests );
+
+		// TODO: Add a child suite for algorithm_types once tests exist for them
 		// add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, algorithm_types ) );
 		// add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, algorithm_types ) );
 
-		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, trait_types ) );
-		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, trait_types ) );
+		test_suite *trait_tests = BOOST_TEST_SUITE( "TraitTests" );
+		trait_tests->add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, trait_types ) );
+		trait_tests->add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, trait_types ) );
+		add( trait_tests );
 
-		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, individual_types ) );
-		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, individual_types ) );
+		test_suite *individual_tests = BOOST_TEST_SUITE( "IndividualTests" );
+		individual_tests->add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, individual_types ) );
+		individual_tests->add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, individual_types ) );
+		add( individual_tests );
 	}
 
     G_API_GENEVA ~GenevaStandardTestSuite() {